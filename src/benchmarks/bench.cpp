@@ -0,0 +1,57 @@
+#include "bench.h"
+
+#include <unistd.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+namespace {
+thread_local std::size_t allocation_count = 0;
+}  // namespace
+
+std::size_t s21_bench::AllocationCount() noexcept { return allocation_count; }
+
+std::size_t s21_bench::ResidentBytes() noexcept {
+  std::FILE* statm = std::fopen("/proc/self/statm", "r");
+  if (statm == nullptr) return 0;
+  unsigned long pages = 0;
+  unsigned long resident = 0;
+  const int read = std::fscanf(statm, "%lu %lu", &pages, &resident);
+  std::fclose(statm);
+  if (read != 2) return 0;
+  return static_cast<std::size_t>(resident) *
+         static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+bool s21_bench::PinToCpu(unsigned cpu) noexcept {
+#ifdef __linux__
+  const unsigned cpus = std::max(1U, std::thread::hardware_concurrency());
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu % cpus, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  static_cast<void>(cpu);
+  return false;
+#endif
+}
+
+void* operator new(std::size_t size) {
+  ++allocation_count;
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+BENCHMARK_MAIN();
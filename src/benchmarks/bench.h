@@ -0,0 +1,23 @@
+#ifndef SRC_BENCHMARKS_BENCH_H_
+#define SRC_BENCHMARKS_BENCH_H_
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+
+#include "../s21_containers.h"
+#include "../s21_containersplus.h"
+
+namespace s21_bench {
+// Number of global operator new calls made so far by the calling thread.
+std::size_t AllocationCount() noexcept;
+
+// Resident set size of the process in bytes, 0 where /proc is unavailable.
+std::size_t ResidentBytes() noexcept;
+
+// Pins the calling thread to CPU cpu modulo the CPU count. Returns false
+// where pinning is unsupported or fails.
+bool PinToCpu(unsigned cpu) noexcept;
+}  // namespace s21_bench
+
+#endif  // SRC_BENCHMARKS_BENCH_H_
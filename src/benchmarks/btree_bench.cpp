@@ -0,0 +1,103 @@
+#include <memory>
+#include <set>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+
+namespace {
+template <typename K>
+using TreeSet = s21::set<K, std::less<K>, std::allocator<K>>;
+template <typename K>
+using BtreeSet = s21::btree_set<K, std::less<K>, std::allocator<K>>;
+
+std::vector<int> Probes(int n, int count) {
+  std::vector<int> probes(count);
+  unsigned state = 2463534242U;
+  for (int& probe : probes) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    probe = static_cast<int>(state % static_cast<unsigned>(n));
+  }
+  return probes;
+}
+}  // namespace
+
+// Random lookups into a set of n consecutive ints built from sorted input.
+// Both containers use the general heap here, so bytes_per_key is the
+// resident growth of the build including malloc's own overhead.
+template <typename Set>
+static void BM_OrderedLookup(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> probes = Probes(n, 1 << 20);
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+#ifdef __GLIBC__
+  malloc_trim(0);
+#endif
+  const std::size_t before = s21_bench::ResidentBytes();
+  auto set = std::make_unique<Set>(Set::from_sorted(keys.begin(), keys.end()));
+  const std::size_t after = s21_bench::ResidentBytes();
+  std::vector<int>().swap(keys);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set->find(probes[i]));
+    if (++i == probes.size()) i = 0;
+  }
+  state.counters["bytes_per_key"] = benchmark::Counter(
+      after > before ? static_cast<double>(after - before) / n : 0);
+}
+BENCHMARK_TEMPLATE(BM_OrderedLookup, TreeSet<int>)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+BENCHMARK_TEMPLATE(BM_OrderedLookup, BtreeSet<int>)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+
+// Random-order inserts, where the B-tree pays for shifting values in nodes.
+template <typename Set>
+static void BM_OrderedInsertRandom(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = Probes(n, n);
+  for (auto _ : state) {
+    Set set;
+    for (int key : keys) set.insert(key);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_OrderedInsertRandom, s21::set<int>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OrderedInsertRandom, s21::btree_set<int>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+// In-order scan, a B-tree walks arrays instead of chasing a pointer per key.
+template <typename Set>
+static void BM_OrderedIterate(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  const Set set = Set::from_sorted(keys.begin(), keys.end());
+  for (auto _ : state) {
+    long long sum = 0;
+    for (int key : set) sum += key;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_OrderedIterate, s21::set<int>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OrderedIterate, s21::btree_set<int>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
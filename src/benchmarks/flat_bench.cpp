@@ -0,0 +1,134 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+
+namespace {
+using TreeMap = s21::map<int, int, std::less<int>,
+                         std::allocator<std::pair<const int, int>>>;
+using BtreeMap = s21::btree_map<int, int, std::less<int>,
+                                std::allocator<std::pair<const int, int>>>;
+using FlatMap = s21::flat_map<int, int>;
+
+std::vector<int> Probes(int n, int count) {
+  std::vector<int> probes(count);
+  unsigned state = 2463534242U;
+  for (int& probe : probes) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    probe = static_cast<int>(state % static_cast<unsigned>(n));
+  }
+  return probes;
+}
+
+std::vector<std::pair<int, int>> Entries(int n) {
+  std::vector<std::pair<int, int>> entries(n);
+  for (int i = 0; i < n; ++i) entries[i] = {i, i * 3};
+  return entries;
+}
+}  // namespace
+
+// Random lookups into a read-only table of n consecutive keys built from
+// sorted input. bytes_per_key is the resident growth of the build.
+template <typename Map>
+static void BM_TableLookup(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> probes = Probes(n, 1 << 20);
+  std::vector<std::pair<int, int>> entries = Entries(n);
+#ifdef __GLIBC__
+  malloc_trim(0);
+#endif
+  const std::size_t before = s21_bench::ResidentBytes();
+  auto map = std::make_unique<Map>(
+      Map::from_sorted(entries.begin(), entries.end()));
+  const std::size_t after = s21_bench::ResidentBytes();
+  std::vector<std::pair<int, int>>().swap(entries);
+  std::size_t i = 0;
+  long long sum = 0;
+  for (auto _ : state) {
+    sum += (*map->find(probes[i])).second;
+    if (++i == probes.size()) i = 0;
+  }
+  benchmark::DoNotOptimize(sum);
+  state.counters["bytes_per_key"] = benchmark::Counter(
+      after > before ? static_cast<double>(after - before) / n : 0);
+}
+BENCHMARK_TEMPLATE(BM_TableLookup, TreeMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Iterations(2000000);
+BENCHMARK_TEMPLATE(BM_TableLookup, BtreeMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Iterations(2000000);
+BENCHMARK_TEMPLATE(BM_TableLookup, FlatMap)
+    ->Arg(10000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Iterations(2000000);
+
+// Full scan summing the mapped values.
+template <typename Map>
+static void BM_TableIterate(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<std::pair<int, int>> entries = Entries(n);
+  const Map map = Map::from_sorted(entries.begin(), entries.end());
+  for (auto _ : state) {
+    long long sum = 0;
+    for (auto it = map.begin(); it != map.end(); ++it) sum += (*it).second;
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TableIterate, TreeMap)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_TableIterate, BtreeMap)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_TableIterate, FlatMap)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+// Building a table from unsorted entries: one insert per entry for the tree,
+// one sort and merge for the flat map's range insert.
+template <typename Map>
+static void BM_TableBuildUnsorted(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = Probes(n, n);
+  std::vector<std::pair<int, int>> entries(n);
+  for (int i = 0; i < n; ++i) entries[i] = {keys[i], i};
+  for (auto _ : state) {
+    Map map;
+    for (const auto& entry : entries) map.insert(entry);
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_TableBuildUnsorted, TreeMap)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TableBuildUnsortedFlatBatch(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = Probes(n, n);
+  std::vector<std::pair<int, int>> entries(n);
+  for (int i = 0; i < n; ++i) entries[i] = {keys[i], i};
+  for (auto _ : state) {
+    FlatMap map;
+    map.insert(entries.begin(), entries.end());
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TableBuildUnsortedFlatBatch)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
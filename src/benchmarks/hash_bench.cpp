@@ -0,0 +1,120 @@
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+
+namespace {
+using HashMap = s21::unordered_map<int, int>;
+using StdHashMap = std::unordered_map<int, int>;
+
+// The i-th key, distinct for every i: an odd multiplier is a bijection.
+int Key(std::uint32_t i) { return static_cast<int>(i * 2654435761U); }
+
+// count indices in [first, first + n), in a scrambled order.
+std::vector<int> Probes(std::uint32_t first, std::uint32_t n, int count) {
+  std::vector<int> probes(count);
+  unsigned state = 2463534242U;
+  for (int &probe : probes) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    probe = Key(first + state % n);
+  }
+  return probes;
+}
+
+template <typename Map>
+std::unique_ptr<Map> Build(std::uint32_t n) {
+  auto map = std::make_unique<Map>();
+  map->reserve(n);
+  for (std::uint32_t i = 0; i < n; ++i) map->insert({Key(i), 1});
+  return map;
+}
+
+// Looks up count random keys, hits when first is 0 and misses when it is n.
+// bytes_per_key is the resident growth of the build.
+template <typename Map>
+void Lookup(benchmark::State &state, std::uint32_t first) {
+  const auto n = static_cast<std::uint32_t>(state.range(0));
+  const std::vector<int> probes = Probes(first, n, 1 << 20);
+#ifdef __GLIBC__
+  malloc_trim(0);
+#endif
+  const std::size_t before = s21_bench::ResidentBytes();
+  const std::unique_ptr<Map> map = Build<Map>(n);
+  const std::size_t after = s21_bench::ResidentBytes();
+  std::size_t i = 0;
+  long long found = 0;
+  for (auto _ : state) {
+    found += map->find(probes[i]) != map->end();
+    if (++i == probes.size()) i = 0;
+  }
+  benchmark::DoNotOptimize(found);
+  state.counters["bytes_per_key"] = benchmark::Counter(
+      after > before ? static_cast<double>(after - before) / n : 0);
+}
+}  // namespace
+
+template <typename Map>
+static void BM_HashLookupHit(benchmark::State &state) {
+  Lookup<Map>(state, 0);
+}
+BENCHMARK_TEMPLATE(BM_HashLookupHit, HashMap)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+BENCHMARK_TEMPLATE(BM_HashLookupHit, StdHashMap)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+
+template <typename Map>
+static void BM_HashLookupMiss(benchmark::State &state) {
+  Lookup<Map>(state, static_cast<std::uint32_t>(state.range(0)));
+}
+BENCHMARK_TEMPLATE(BM_HashLookupMiss, HashMap)
+    ->Arg(1000)
+    ->Arg(1000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+BENCHMARK_TEMPLATE(BM_HashLookupMiss, StdHashMap)
+    ->Arg(1000)
+    ->Arg(1000000)
+    ->Arg(50000000)
+    ->Iterations(2000000);
+
+// Inserting n distinct keys into an empty table that grows as it goes.
+template <typename Map>
+static void BM_HashInsert(benchmark::State &state) {
+  const auto n = static_cast<std::uint32_t>(state.range(0));
+  for (auto _ : state) {
+    Map map;
+    for (std::uint32_t i = 0; i < n; ++i) map.insert({Key(i), 1});
+    benchmark::DoNotOptimize(map.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_HashInsert, HashMap)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashInsert, StdHashMap)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,94 @@
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+
+namespace {
+constexpr int kItems = 1 << 18;
+constexpr std::size_t kCapacity = 1024;
+
+// Bounded s21::queue behind one mutex, the worker pool setup mpmc_queue
+// replaces.
+class LockedQueue {
+ public:
+  explicit LockedQueue(std::size_t capacity) : capacity(capacity) {}
+
+  void push(int value) {
+    std::unique_lock<std::mutex> lock(mutex);
+    notFull.wait(lock, [this] { return size < capacity; });
+    queue.push(value);
+    ++size;
+    notEmpty.notify_one();
+  }
+  void pop(int& out) {
+    std::unique_lock<std::mutex> lock(mutex);
+    notEmpty.wait(lock, [this] { return size > 0; });
+    out = queue.front();
+    queue.pop();
+    --size;
+    notFull.notify_one();
+  }
+
+ private:
+  std::mutex mutex;
+  std::condition_variable notFull;
+  std::condition_variable notEmpty;
+  s21::queue<int> queue;
+  std::size_t size = 0;
+  std::size_t capacity;
+};
+
+// range(0) producers and as many consumers move kItems ints through the
+// queue with the blocking push and pop. Thread i is pinned to CPU i.
+template <typename Queue>
+void Transfer(benchmark::State& state) {
+  const auto side = static_cast<int>(state.range(0));
+  const int perThread = kItems / side;
+  for (auto _ : state) {
+    Queue queue(kCapacity);
+    std::vector<long long> sums(side);
+    std::vector<std::thread> threads;
+    for (int p = 0; p < side; ++p) {
+      threads.emplace_back([&queue, p, perThread] {
+        s21_bench::PinToCpu(static_cast<unsigned>(p));
+        for (int i = 0; i < perThread; ++i) queue.push(i);
+      });
+    }
+    for (int c = 0; c < side; ++c) {
+      threads.emplace_back([&queue, &sums, c, side, perThread] {
+        s21_bench::PinToCpu(static_cast<unsigned>(side + c));
+        long long sum = 0;
+        for (int i = 0, value = 0; i < perThread; ++i) {
+          queue.pop(value);
+          sum += value;
+        }
+        sums[c] = sum;
+      });
+    }
+    for (auto& thread : threads) thread.join();
+    benchmark::DoNotOptimize(sums.data());
+  }
+  state.SetItemsProcessed(state.iterations() * perThread * side);
+  state.counters["threads"] = 2 * side;
+}
+}  // namespace
+
+static void BM_MpmcTransfer(benchmark::State& state) {
+  Transfer<s21::mpmc_queue<int>>(state);
+}
+BENCHMARK(BM_MpmcTransfer)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_LockedQueueTransfer(benchmark::State& state) {
+  Transfer<LockedQueue>(state);
+}
+BENCHMARK(BM_LockedQueueTransfer)
+    ->RangeMultiplier(2)
+    ->Range(1, 32)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,159 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+#include "bench.h"
+
+namespace {
+template <typename T>
+using HeapList = s21::List<T, std::allocator<T>>;
+template <typename T>
+using PoolList = s21::List<T, s21::PoolAllocator<T>>;
+template <typename K>
+using HeapSet = s21::set<K, std::less<K>, std::allocator<K>>;
+template <typename K>
+using PoolSet = s21::set<K, std::less<K>, s21::PoolAllocator<K>>;
+template <typename K, typename V>
+using HeapMap =
+    s21::map<K, V, std::less<K>, std::allocator<std::pair<const K, V>>>;
+template <typename K, typename V>
+using PoolMap =
+    s21::map<K, V, std::less<K>, s21::PoolAllocator<std::pair<const K, V>>>;
+template <typename T>
+using HeapQueue = s21::queue<T, std::allocator<T>>;
+template <typename T>
+using PoolQueue = s21::queue<T, s21::PoolAllocator<T>>;
+
+// Cheap xorshift so the key sequence does not depend on <random>.
+unsigned NextKey(unsigned& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+}  // namespace
+
+template <typename Container>
+static void BM_ListInsertErase(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  Container list;
+  for (auto _ : state) {
+    for (int i = 0; i < n; ++i) list.Push_Back(i);
+    for (int i = 0; i < n; ++i) list.Pop_Front();
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(BM_ListInsertErase, HeapList<int>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_ListInsertErase, PoolList<int>)->Range(1 << 10, 1 << 18);
+
+template <typename Container>
+static void BM_SetInsertErase(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    Container set;
+    unsigned seed = 2463534242U;
+    for (int i = 0; i < n; ++i) set.insert(static_cast<int>(NextKey(seed)));
+    while (!set.empty()) set.erase(set.begin());
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(BM_SetInsertErase, HeapSet<int>)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_SetInsertErase, PoolSet<int>)->Range(1 << 10, 1 << 16);
+
+// Fills a map and reports how much the resident set grew, the pool packs
+// nodes densely while the general-purpose heap adds per-chunk headers.
+template <typename Container>
+static void BM_MapFillRss(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  double grown = 0;
+  for (auto _ : state) {
+#ifdef __GLIBC__
+    malloc_trim(0);  // hand back pages freed by earlier runs before measuring
+#endif
+    const std::size_t before = s21_bench::ResidentBytes();
+    auto map = std::make_unique<Container>();
+    unsigned seed = 88172645U;
+    for (int i = 0; i < n; ++i) map->insert(static_cast<int>(NextKey(seed)), i);
+    const std::size_t after = s21_bench::ResidentBytes();
+    grown = after > before ? static_cast<double>(after - before) : 0;
+    benchmark::DoNotOptimize(map->size());
+  }
+  state.counters["rss_bytes_per_node"] =
+      benchmark::Counter(grown / static_cast<double>(n));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MapFillRss, HeapMap<int, int>)
+    ->Arg(1 << 20)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MapFillRss, PoolMap<int, int>)
+    ->Arg(1 << 20)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+
+// A producer thread pushes through a mutex-guarded queue kept about 1000
+// deep while the benchmark thread pops, so every node is allocated on one
+// thread and freed on the other. Reports the peak resident set growth,
+// which stays flat only if freed nodes find their way back to the producer.
+template <typename Queue>
+static void BM_CrossThreadQueueRss(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  constexpr std::size_t kDepth = 1000;
+  constexpr int kSampleEvery = 1 << 16;
+  double grown = 0;
+  for (auto _ : state) {
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    const std::size_t before = s21_bench::ResidentBytes();
+    std::size_t peak = before;
+    Queue queue;
+    std::size_t depth = 0;  // guarded by mutex, queue::size walks the nodes
+    std::mutex mutex;
+    std::thread producer([&] {
+      for (int i = 0; i < n;) {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          for (; i < n && depth < kDepth; ++i, ++depth) queue.push(i);
+        }
+        std::this_thread::yield();
+      }
+    });
+    long long sum = 0;
+    for (int popped = 0; popped < n;) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (; !queue.empty(); ++popped, --depth) {
+          sum += queue.front();
+          queue.pop();
+          if (popped % kSampleEvery == 0)
+            peak = std::max(peak, s21_bench::ResidentBytes());
+        }
+      }
+      std::this_thread::yield();
+    }
+    producer.join();
+    benchmark::DoNotOptimize(sum);
+    grown = static_cast<double>(peak - before);
+  }
+  state.counters["peak_rss_growth"] = benchmark::Counter(
+      grown, benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK_TEMPLATE(BM_CrossThreadQueueRss, HeapQueue<int>)
+    ->Arg(20 << 20)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CrossThreadQueueRss, PoolQueue<int>)
+    ->Arg(20 << 20)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,39 @@
+#include "bench.h"
+
+template <typename Container>
+static void BM_FillSmall(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::size_t allocations = s21_bench::AllocationCount();
+  for (auto _ : state) {
+    Container v;
+    for (int i = 0; i < n; ++i) v.Push_Back(i);
+    benchmark::DoNotOptimize(v.Data());
+  }
+  state.counters["allocs_per_fill"] = benchmark::Counter(
+      static_cast<double>(s21_bench::AllocationCount() - allocations) /
+      static_cast<double>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(BM_FillSmall, s21::Vector<int>)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(32)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_FillSmall, s21::SmallVector<int, 16>)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(32)
+    ->Arg(64);
+BENCHMARK_TEMPLATE(BM_FillSmall, s21::SmallVector<int, 64>)
+    ->Arg(0)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(8)
+    ->Arg(16)
+    ->Arg(32)
+    ->Arg(64);
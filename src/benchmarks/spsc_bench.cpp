@@ -0,0 +1,161 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bench.h"
+
+namespace {
+constexpr int kItems = 1 << 20;
+constexpr std::size_t kCapacity = 1024;
+
+// s21::queue behind a mutex, the pipeline setup spsc_queue replaces.
+class LockedQueue {
+ public:
+  void push(int value) {
+    std::lock_guard<std::mutex> lock(mutex);
+    queue.push(value);
+  }
+  bool try_pop(int& out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (queue.empty()) return false;
+    out = queue.front();
+    queue.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex;
+  s21::queue<int> queue;
+};
+
+// Runs produce on a thread pinned to CPU 1 and consume on this thread,
+// pinned to CPU 0.
+template <typename Produce, typename Consume>
+void RunPair(Produce produce, Consume consume) {
+  std::thread producer([&produce] {
+    s21_bench::PinToCpu(1);
+    produce();
+  });
+  consume();
+  producer.join();
+}
+}  // namespace
+
+// Moving kItems ints from a producer to a consumer thread one at a time.
+static void BM_SpscThroughput(benchmark::State& state) {
+  s21_bench::PinToCpu(0);
+  for (auto _ : state) {
+    s21::spsc_queue<int> queue(kCapacity);
+    long long sum = 0;
+    RunPair(
+        [&queue] {
+          for (int i = 0; i < kItems; ++i) queue.push(i);
+        },
+        [&queue, &sum] {
+          for (int i = 0, value = 0; i < kItems;) {
+            if (queue.try_pop(value)) {
+              sum += value;
+              ++i;
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+BENCHMARK(BM_SpscThroughput)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// The same transfer in batches of up to range(0) values per call.
+static void BM_SpscThroughputBatch(benchmark::State& state) {
+  const auto batch = static_cast<std::size_t>(state.range(0));
+  s21_bench::PinToCpu(0);
+  for (auto _ : state) {
+    s21::spsc_queue<int> queue(kCapacity);
+    long long sum = 0;
+    RunPair(
+        [&queue, batch] {
+          std::vector<int> values(batch);
+          for (int i = 0; i < kItems;) {
+            const std::size_t n = std::min<std::size_t>(batch, kItems - i);
+            for (std::size_t j = 0; j < n; ++j) values[j] = i + j;
+            for (std::size_t pushed = 0; pushed < n;) {
+              const std::size_t done =
+                  queue.try_push_n(values.begin() + pushed, n - pushed);
+              if (done == 0) std::this_thread::yield();
+              pushed += done;
+            }
+            i += static_cast<int>(n);
+          }
+        },
+        [&queue, &sum, batch] {
+          std::vector<int> values(batch);
+          for (int i = 0; i < kItems;) {
+            const std::size_t n = queue.try_pop_n(values.begin(), batch);
+            if (n == 0) std::this_thread::yield();
+            for (std::size_t j = 0; j < n; ++j) sum += values[j];
+            i += static_cast<int>(n);
+          }
+        });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+BENCHMARK(BM_SpscThroughputBatch)
+    ->Arg(16)
+    ->Arg(256)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+static void BM_LockedQueueThroughput(benchmark::State& state) {
+  s21_bench::PinToCpu(0);
+  for (auto _ : state) {
+    LockedQueue queue;
+    long long sum = 0;
+    RunPair(
+        [&queue] {
+          for (int i = 0; i < kItems; ++i) queue.push(i);
+        },
+        [&queue, &sum] {
+          for (int i = 0, value = 0; i < kItems;) {
+            if (queue.try_pop(value)) {
+              sum += value;
+              ++i;
+            } else {
+              std::this_thread::yield();
+            }
+          }
+        });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * kItems);
+}
+BENCHMARK(BM_LockedQueueThroughput)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// Round trip of one value to an echo thread and back over two queues.
+static void BM_SpscRoundTrip(benchmark::State& state) {
+  s21_bench::PinToCpu(0);
+  s21::spsc_queue<int> ping(kCapacity);
+  s21::spsc_queue<int> pong(kCapacity);
+  std::thread echo([&ping, &pong] {
+    s21_bench::PinToCpu(1);
+    for (int value = 0; value >= 0;) {
+      if (ping.try_pop(value))
+        pong.push(value);
+      else
+        std::this_thread::yield();
+    }
+  });
+  int value = 0;
+  for (auto _ : state) {
+    ping.push(value);
+    while (!pong.try_pop(value)) std::this_thread::yield();
+    ++value;
+  }
+  ping.push(-1);
+  echo.join();
+}
+BENCHMARK(BM_SpscRoundTrip)->UseRealTime();
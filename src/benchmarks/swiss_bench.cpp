@@ -0,0 +1,78 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "bench.h"
+
+namespace {
+using SwissSet = s21::flat_hash_set<std::string>;
+using RobinHoodSet = s21::unordered_set<std::string>;
+using StdHashSet = std::unordered_set<std::string>;
+using TreeSet = s21::set<std::string>;
+
+// Keys the length of typical session ids, past the small string buffer.
+std::string Key(std::uint32_t i) {
+  return "session:" + std::to_string(i * 2654435761U) + ":user";
+}
+
+// count keys with indices in [first, first + n), in a scrambled order.
+std::vector<std::string> Probes(std::uint32_t first, std::uint32_t n,
+                                int count) {
+  std::vector<std::string> probes(count);
+  unsigned state = 2463534242U;
+  for (auto &probe : probes) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    probe = Key(first + state % n);
+  }
+  return probes;
+}
+
+// Membership checks on as many keys as fill a flat_hash_set of range(0)
+// slots to range(1) percent, all hits or all misses.
+template <typename Set>
+void Contains(benchmark::State &state, bool hits) {
+  const auto slots = static_cast<std::uint32_t>(state.range(0));
+  const auto n = static_cast<std::uint32_t>(
+      static_cast<std::uint64_t>(slots) * state.range(1) / 100);
+  auto set = std::make_unique<Set>();
+  for (std::uint32_t i = 0; i < n; ++i) set->insert(Key(i));
+  const std::vector<std::string> probes = Probes(hits ? 0 : n, n, 1 << 18);
+  std::size_t i = 0;
+  long long found = 0;
+  for (auto _ : state) {
+    found += set->find(probes[i]) != set->end();
+    if (++i == probes.size()) i = 0;
+  }
+  benchmark::DoNotOptimize(found);
+  state.counters["keys"] = n;
+}
+
+void LoadArgs(benchmark::internal::Benchmark *bench) {
+  for (std::int64_t slots : {1 << 14, 1 << 20}) {
+    for (std::int64_t load : {45, 85}) bench->Args({slots, load});
+  }
+  bench->Iterations(2000000);
+}
+}  // namespace
+
+template <typename Set>
+static void BM_SwissContainsHit(benchmark::State &state) {
+  Contains<Set>(state, true);
+}
+BENCHMARK_TEMPLATE(BM_SwissContainsHit, SwissSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsHit, RobinHoodSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsHit, StdHashSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsHit, TreeSet)->Apply(LoadArgs);
+
+template <typename Set>
+static void BM_SwissContainsMiss(benchmark::State &state) {
+  Contains<Set>(state, false);
+}
+BENCHMARK_TEMPLATE(BM_SwissContainsMiss, SwissSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsMiss, RobinHoodSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsMiss, StdHashSet)->Apply(LoadArgs);
+BENCHMARK_TEMPLATE(BM_SwissContainsMiss, TreeSet)->Apply(LoadArgs);
@@ -0,0 +1,380 @@
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bench.h"
+
+namespace {
+std::vector<int> SortedKeys(int n) {
+  std::vector<int> keys(n);
+  for (int i = 0; i < n; ++i) keys[i] = i;
+  return keys;
+}
+
+std::vector<int> RandomKeys(int n) {
+  std::vector<int> keys = SortedKeys(n);
+  unsigned state = 2463534242U;
+  for (int i = n - 1; i > 0; --i) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    std::swap(keys[i], keys[state % static_cast<unsigned>(i + 1)]);
+  }
+  return keys;
+}
+
+// Longest root-to-node path, found by walking parent links from every node.
+template <typename Set>
+int MaxDepth(Set& set) {
+  int depth = 0;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    int d = 0;
+    for (auto node = it.node_; node != nullptr; node = node->parent_) ++d;
+    depth = std::max(depth, d);
+  }
+  return depth;
+}
+}  // namespace
+
+template <bool Sorted>
+static void BM_SetInsert(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = Sorted ? SortedKeys(n) : RandomKeys(n);
+  int depth = 0;
+  for (auto _ : state) {
+    s21::set<int> set;
+    for (int key : keys) set.insert(key);
+    state.PauseTiming();
+    depth = MaxDepth(set);
+    state.ResumeTiming();
+  }
+  state.counters["depth"] = depth;
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SetInsert, true)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SetInsert, false)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+template <bool Sorted>
+static void BM_StdSetInsert(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = Sorted ? SortedKeys(n) : RandomKeys(n);
+  for (auto _ : state) {
+    std::set<int> set;
+    for (int key : keys) set.insert(key);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_StdSetInsert, true)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_StdSetInsert, false)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_SetFindSorted(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  s21::set<int> set;
+  for (int i = 0; i < n; ++i) set.insert(i);
+  const std::vector<int> probes = RandomKeys(n);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(set.find(probes[i]));
+    if (++i == probes.size()) i = 0;
+  }
+  state.counters["depth"] = MaxDepth(set);
+}
+BENCHMARK(BM_SetFindSorted)->Range(1 << 10, 1 << 20);
+
+// Lookups in a map keyed by strings too long for the small-string buffer.
+// allocs_per_lookup shows whether a search has to materialise a key or value.
+std::vector<std::string> LongNames(int n) {
+  std::vector<std::string> names;
+  names.reserve(n);
+  for (int key : RandomKeys(n))
+    names.push_back("customer-profile-" + std::to_string(key));
+  return names;
+}
+
+template <typename Map, typename Probe>
+static void BM_MapFindString(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<std::string> names = LongNames(n);
+  Map map;
+  for (int i = 0; i < n; ++i) map.insert(names[i], std::vector<int>(4, i));
+  const std::vector<std::string> probes = LongNames(n);
+  std::size_t allocations = 0;
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const std::size_t before = s21_bench::AllocationCount();
+    benchmark::DoNotOptimize(map.find(Probe(probes[i])));
+    allocations += s21_bench::AllocationCount() - before;
+    if (++i == probes.size()) i = 0;
+  }
+  state.counters["allocs_per_lookup"] =
+      benchmark::Counter(static_cast<double>(allocations) /
+                         static_cast<double>(state.iterations()));
+}
+BENCHMARK_TEMPLATE(BM_MapFindString,
+                   s21::map<std::string, std::vector<int>>,
+                   const std::string&)
+    ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_MapFindString,
+                   s21::map<std::string, std::vector<int>, std::less<>>,
+                   std::string_view)
+    ->Arg(100000);
+
+// Queries against a multiset of 1M keys drawn from only four values, so every
+// key has 250k duplicates. Counting used to walk all of them.
+template <typename Multiset>
+static Multiset HotKeys(int n) {
+  Multiset ms;
+  for (int i = 0; i < n; ++i) ms.insert(i % 4);
+  return ms;
+}
+
+template <typename Multiset>
+static void BM_MultisetCountHot(benchmark::State& state) {
+  const auto ms = HotKeys<Multiset>(static_cast<int>(state.range(0)));
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ms.count(key));
+    key = (key + 1) & 3;
+  }
+}
+BENCHMARK_TEMPLATE(BM_MultisetCountHot, s21::multiset<int>)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_MultisetCountHot, std::multiset<int>)
+    ->Arg(1000000)
+    ->Unit(benchmark::kMicrosecond);
+
+template <typename Multiset>
+static void BM_MultisetEqualRangeHot(benchmark::State& state) {
+  const auto ms = HotKeys<Multiset>(static_cast<int>(state.range(0)));
+  int key = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ms.equal_range(key));
+    key = (key + 1) & 3;
+  }
+}
+BENCHMARK_TEMPLATE(BM_MultisetEqualRangeHot, s21::multiset<int>)
+    ->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_MultisetEqualRangeHot, std::multiset<int>)
+    ->Arg(1000000);
+
+// Percentile and rank queries over a multiset of latency-like samples with
+// many repeats. The walk variant is what callers had to do before select.
+static std::vector<int> Samples(int n) {
+  std::vector<int> samples(n);
+  unsigned state = 2463534242U;
+  for (int& sample : samples) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    sample = static_cast<int>(state % 100000U);
+  }
+  std::sort(samples.begin(), samples.end());
+  return samples;
+}
+
+static void BM_MultisetPercentile(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> samples = Samples(n);
+  const auto ms =
+      s21::multiset<int>::from_sorted(samples.begin(), samples.end());
+  const std::size_t p50 = ms.size() / 2;
+  const std::size_t p99 = ms.size() / 100 * 99;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ms.nth_element(p50));
+    benchmark::DoNotOptimize(ms.nth_element(p99));
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_MultisetPercentile)->Arg(10000000);
+
+static void BM_MultisetPercentileWalk(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> samples = Samples(n);
+  const auto ms =
+      s21::multiset<int>::from_sorted(samples.begin(), samples.end());
+  const auto p50 = static_cast<std::ptrdiff_t>(ms.size() / 2);
+  const auto p99 = static_cast<std::ptrdiff_t>(ms.size() / 100 * 99);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::next(ms.begin(), p50));
+    benchmark::DoNotOptimize(std::next(ms.begin(), p99));
+  }
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_MultisetPercentileWalk)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_MultisetRank(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> samples = Samples(n);
+  const auto ms =
+      s21::multiset<int>::from_sorted(samples.begin(), samples.end());
+  const std::vector<int> probes = RandomKeys(100000);
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(ms.rank(probes[i]));
+    if (++i == probes.size()) i = 0;
+  }
+}
+BENCHMARK(BM_MultisetRank)->Arg(10000000);
+
+// Steady insert/erase mix on a 1M-key map. Only the erase calls are counted,
+// relinking in place means they never reach operator new.
+static void BM_MapChurn(benchmark::State& state) {
+  using heap_map = s21::map<int, int, std::less<int>,
+                            std::allocator<std::pair<const int, int>>>;
+  const auto n = static_cast<int>(state.range(0));
+  const std::vector<int> keys = RandomKeys(2 * n);
+  heap_map map;
+  for (int i = 0; i < n; ++i) map.insert(keys[i], i);
+  std::size_t erase_allocations = 0;
+  int in = n;
+  int out = 0;
+  for (auto _ : state) {
+    const std::size_t before = s21_bench::AllocationCount();
+    map.erase(map.find(keys[out]));
+    erase_allocations += s21_bench::AllocationCount() - before;
+    map.insert(keys[in], in);
+    out = (out + 1) % (2 * n);
+    in = (in + 1) % (2 * n);
+  }
+  state.counters["allocs_per_erase"] =
+      benchmark::Counter(static_cast<double>(erase_allocations) /
+                         static_cast<double>(state.iterations()));
+  state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(BM_MapChurn)->Arg(1000000);
+
+// Time spent in the destructor alone, the map is rebuilt outside the timer.
+template <typename Map>
+static void BM_MapDestroy(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto map = std::make_unique<Map>();
+    for (int i = 0; i < n; ++i) map->insert({i, i});
+    state.ResumeTiming();
+    map.reset();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_MapDestroy, s21::map<int, int>)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_MapDestroy, std::map<int, int>)
+    ->Arg(1000000)
+    ->Arg(10000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+// Read-only snapshot of a large map, i.e. the copy constructor.
+static void BM_MapSnapshot(benchmark::State& state) {
+  const auto n = static_cast<int>(state.range(0));
+  s21::map<int, int> map;
+  for (int key : RandomKeys(n)) map.insert(key, key);
+  for (auto _ : state) {
+    s21::map<int, int> snapshot(map);
+    benchmark::DoNotOptimize(snapshot.size());
+    state.PauseTiming();
+    {
+      s21::map<int, int> discard(std::move(snapshot));
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MapSnapshot)
+    ->Arg(100000)
+    ->Arg(5000000)
+    ->Iterations(3)
+    ->Unit(benchmark::kMillisecond);
+
+// Building from a sorted dump: one insert per key against the bulk path.
+static void BM_SetBuildInsert(benchmark::State& state) {
+  const std::vector<int> keys = SortedKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::set<int> set;
+    for (int key : keys) set.insert(key);
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SetBuildInsert)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_SetBuildFromSorted(benchmark::State& state) {
+  const std::vector<int> keys = SortedKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    auto set = s21::set<int>::from_sorted(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SetBuildFromSorted)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_SetBuildFromUnsorted(benchmark::State& state) {
+  const std::vector<int> keys = RandomKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    s21::set<int> set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SetBuildFromUnsorted)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+static void BM_StdSetBuildRange(benchmark::State& state) {
+  const std::vector<int> keys = SortedKeys(static_cast<int>(state.range(0)));
+  for (auto _ : state) {
+    std::set<int> set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdSetBuildRange)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+// Merging two disjoint sets, the building of the inputs is not timed.
+static void BM_SetMerge(benchmark::State& state) {
+  using heap_set = s21::set<int, std::less<int>, std::allocator<int>>;
+  const auto n = static_cast<int>(state.range(0));
+  std::vector<int> evens(n);
+  std::vector<int> odds(n);
+  for (int i = 0; i < n; ++i) {
+    evens[i] = 2 * i;
+    odds[i] = 2 * i + 1;
+  }
+  std::size_t allocations = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto target = heap_set::from_sorted(evens.begin(), evens.end());
+    auto source = heap_set::from_sorted(odds.begin(), odds.end());
+    const std::size_t before = s21_bench::AllocationCount();
+    state.ResumeTiming();
+    target.merge(source);
+    state.PauseTiming();
+    allocations += s21_bench::AllocationCount() - before;
+    benchmark::DoNotOptimize(target.size());
+    state.ResumeTiming();
+  }
+  state.counters["allocs_per_key"] = benchmark::Counter(
+      static_cast<double>(allocations) /
+      (static_cast<double>(state.iterations()) * static_cast<double>(n)));
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SetMerge)
+    ->Arg(1000000)
+    ->Iterations(5)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,138 @@
+#include <vector>
+
+#include "bench.h"
+
+static void BM_VectorPushBack(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    s21::Vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.Push_Back(static_cast<int>(i));
+    benchmark::DoNotOptimize(v.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorPushBack)->RangeMultiplier(10)->Range(1000, 10000000);
+
+static void BM_StdVectorPushBack(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    std::vector<int> v;
+    for (size_t i = 0; i < n; ++i) v.push_back(static_cast<int>(i));
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdVectorPushBack)->RangeMultiplier(10)->Range(1000, 10000000);
+
+static void BM_VectorPushPopBack(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  s21::Vector<int> v;
+  for (auto _ : state) {
+    for (size_t i = 0; i < n; ++i) v.Push_Back(static_cast<int>(i));
+    for (size_t i = 0; i < n; ++i) v.Pop_Back();
+    benchmark::DoNotOptimize(v.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorPushPopBack)->RangeMultiplier(10)->Range(1000, 1000000);
+
+namespace {
+struct Pod {
+  int key;
+  int value;
+  double weight;
+  char tag[16];
+};
+
+// Same payload without trivial copy operations, forces the element-wise
+// relocation path so both strategies can be compared in one run.
+template <typename T>
+struct Elementwise {
+  T payload;
+  Elementwise() = default;
+  explicit Elementwise(const T& p) : payload(p) {}
+  Elementwise(const Elementwise& other) noexcept : payload(other.payload) {}
+  Elementwise& operator=(const Elementwise& other) noexcept {
+    payload = other.payload;
+    return *this;
+  }
+};
+}  // namespace
+
+template <typename T>
+static void BM_VectorInsertFront(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    s21::Vector<T> v;
+    for (size_t i = 0; i < n; ++i) v.Insert(v.Begin(), T{});
+    benchmark::DoNotOptimize(v.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorInsertFront, int)->Range(1 << 10, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertFront, Elementwise<int>)
+    ->Range(1 << 10, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertFront, Pod)->Range(1 << 10, 1 << 14);
+BENCHMARK_TEMPLATE(BM_VectorInsertFront, Elementwise<Pod>)
+    ->Range(1 << 10, 1 << 14);
+
+template <typename T>
+static void BM_VectorGrowth(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  for (auto _ : state) {
+    s21::Vector<T> v;
+    for (size_t i = 0; i < n; ++i) v.Emplace_Back();
+    benchmark::DoNotOptimize(v.Data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_VectorGrowth, int)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_VectorGrowth, Elementwise<int>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_VectorGrowth, Pod)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_VectorGrowth, Elementwise<Pod>)->Range(1 << 10, 1 << 22);
+
+static s21::Vector<float> MakeSamples(size_t n) {
+  s21::Vector<float> v;
+  v.Reserve(n);
+  for (size_t i = 0; i < n; ++i) v.Push_Back(static_cast<float>(i % 97));
+  return v;
+}
+
+static void BM_VectorSumIndex(benchmark::State& state) {
+  const auto v = MakeSamples(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    float sum = 0.0f;
+    const size_t n = v.Size();
+#pragma omp simd reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) sum += v[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorSumIndex)->Range(1 << 10, 1 << 20);
+
+static void BM_VectorSumAt(benchmark::State& state) {
+  const auto v = MakeSamples(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    float sum = 0.0f;
+    const size_t n = v.Size();
+    for (size_t i = 0; i < n; ++i) sum += v.At(i);
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_VectorSumAt)->Range(1 << 10, 1 << 20);
+
+static void BM_StdVectorSumIndex(benchmark::State& state) {
+  const auto n = static_cast<size_t>(state.range(0));
+  std::vector<float> v(n);
+  for (size_t i = 0; i < n; ++i) v[i] = static_cast<float>(i % 97);
+  for (auto _ : state) {
+    float sum = 0.0f;
+#pragma omp simd reduction(+ : sum)
+    for (size_t i = 0; i < n; ++i) sum += v[i];
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StdVectorSumIndex)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,797 @@
+#ifndef CPP2_S21_CONTAINERS_1_BTREE_H
+#define CPP2_S21_CONTAINERS_1_BTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "BinaryTree.h"
+
+namespace BTree {
+
+// Ordered storage that packs many values into each node, so a search touches
+// one cache-friendly node per level instead of one pointer per comparison.
+// NodeBytes is the target size of a node; the number of values per node is
+// derived from it. Full nodes are split in half, except when the new value
+// goes at the very end: then only the last value moves, so ascending inserts
+// and sorted builds leave full nodes behind.
+//
+// Unlike BinaryTree, values move between nodes when the tree changes: every
+// insert or erase invalidates all iterators.
+template <class T, class Compare = std::less<T>,
+          class Allocator = s21::PoolAllocator<T>,
+          class KeyOfValue = BinaryTree::Identity, size_t NodeBytes = 256>
+class BTree : private BinaryTree::CompareHolder<Compare> {
+ private:
+  struct Node;
+  struct Internal;
+  using compare_holder = BinaryTree::CompareHolder<Compare>;
+  using compare_holder::comp;
+  using value_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename value_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+  using internal_allocator =
+      typename value_traits::template rebind_alloc<Internal>;
+  using internal_traits = std::allocator_traits<internal_allocator>;
+
+  static constexpr size_t kHeaderBytes = sizeof(void *) + 8;
+
+ public:
+  using Key = T;
+  using key_type = std::remove_cv_t<std::remove_reference_t<decltype(
+      KeyOfValue{}(std::declval<const T &>()))>>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+
+  static constexpr size_type kSlots = std::min<size_type>(
+      1024, std::max<size_type>(3, (NodeBytes > kHeaderBytes
+                                        ? NodeBytes - kHeaderBytes
+                                        : 0) /
+                                       sizeof(T)));
+  static constexpr size_type kMinSlots = kSlots / 2;
+
+  static_assert(BinaryTree::Relocation<T>::kNothrow,
+                "values shift between slots during splits, merges and "
+                "rotations, which cannot be undone if a move throws");
+
+  template <class Value>
+  struct basic_iterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    Node *node_;
+    size_type position_;
+
+    basic_iterator(Node *node, size_type position)
+        : node_(node), position_(position) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Value> &&
+                               !std::is_same_v<Other, Value>>>
+    basic_iterator(const basic_iterator<Other> &other)  // NOLINT
+        : node_(other.node_), position_(other.position_) {}
+
+    basic_iterator &operator++() &noexcept {
+      if (node_ == nullptr) return *this;
+      if (!node_->leaf_) {
+        node_ = static_cast<Internal *>(node_)->children_[position_ + 1];
+        while (!node_->leaf_)
+          node_ = static_cast<Internal *>(node_)->children_[0];
+        position_ = 0;
+        return *this;
+      }
+      if (++position_ < node_->count_) return *this;
+      while (node_->parent_ != nullptr &&
+             node_->position_ == node_->parent_->count_)
+        node_ = node_->parent_;
+      if (node_->parent_ == nullptr) {
+        node_ = nullptr;
+        position_ = 0;
+      } else {
+        position_ = node_->position_;
+        node_ = node_->parent_;
+      }
+      return *this;
+    }
+
+    basic_iterator operator++(int) &noexcept {
+      basic_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    basic_iterator &operator--() &noexcept {
+      if (node_ == nullptr) return *this;
+      if (!node_->leaf_) {
+        node_ = static_cast<Internal *>(node_)->children_[position_];
+        while (!node_->leaf_)
+          node_ = static_cast<Internal *>(node_)->children_[node_->count_];
+        position_ = node_->count_ - 1;
+        return *this;
+      }
+      if (position_ > 0) {
+        --position_;
+        return *this;
+      }
+      while (node_->parent_ != nullptr && node_->position_ == 0)
+        node_ = node_->parent_;
+      if (node_->parent_ == nullptr) {
+        node_ = nullptr;
+        position_ = 0;
+      } else {
+        position_ = node_->position_ - 1;
+        node_ = node_->parent_;
+      }
+      return *this;
+    }
+
+    friend bool operator==(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return a.node_ == b.node_ && a.position_ == b.position_;
+    }
+    friend bool operator!=(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return !(a == b);
+    }
+
+    Value &operator*() const { return *node_->value(position_); }
+    Value *operator->() const { return node_->value(position_); }
+  };
+
+  using iterator = basic_iterator<Key>;
+  using const_iterator = basic_iterator<const Key>;
+
+  BTree() : BTree(Compare(), Allocator()) {}
+  explicit BTree(const allocator_type &alloc) : BTree(Compare(), alloc) {}
+  explicit BTree(const Compare &comp,
+                 const allocator_type &alloc = allocator_type())
+      : compare_holder(comp), root_(nullptr), size_(0), node_alloc_(alloc) {}
+  BTree(const BTree &other)
+      : BTree(other.comp(), node_traits::select_on_container_copy_construction(
+                                other.node_alloc_)) {
+    copy_from(other);
+  }
+  BTree(BTree &&other) noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+      : compare_holder(other.comp()),
+        root_(other.root_),
+        size_(other.size_),
+        node_alloc_(std::move(other.node_alloc_)) {
+    other.root_ = nullptr;
+    other.size_ = 0;
+  }
+
+  ~BTree() { clear(); }
+
+  BTree &operator=(const BTree &other) & {
+    if (this == &other) return *this;
+    clear();
+    comp() = other.comp();
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+      node_alloc_ = other.node_alloc_;
+    copy_from(other);
+    return *this;
+  }
+
+  BTree &operator=(BTree &&other) &noexcept(
+      (node_traits::propagate_on_container_move_assignment::value ||
+       node_traits::is_always_equal::value) &&
+      std::is_nothrow_copy_assignable_v<Compare>) {
+    if (this == &other) return *this;
+    clear();
+    comp() = other.comp();
+    if constexpr (node_traits::propagate_on_container_move_assignment::
+                      value) {
+      node_alloc_ = std::move(other.node_alloc_);
+    } else if (node_alloc_ != other.node_alloc_) {
+      for (auto &item : other) append(std::move(item));
+      other.clear();
+      return *this;
+    }
+    root_ = other.root_;
+    size_ = other.size_;
+    other.root_ = nullptr;
+    other.size_ = 0;
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(node_alloc_);
+  }
+
+  key_compare key_comp() const { return comp(); }
+
+  iterator begin() noexcept {
+    if (size_ == 0) return end();
+    Node *node = root_;
+    while (!node->leaf_) node = static_cast<Internal *>(node)->children_[0];
+    return iterator(node, 0);
+  }
+  const_iterator begin() const noexcept {
+    return const_cast<BTree *>(this)->begin();
+  }
+  iterator end() noexcept { return iterator(nullptr, 0); }
+  const_iterator end() const noexcept { return const_iterator(nullptr, 0); }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min<size_type>(SIZE_MAX / sizeof(T) / 2,
+                               node_traits::max_size(node_alloc_));
+  }
+
+  void clear() noexcept {
+    if (root_ != nullptr) destroy_subtree(root_);
+    root_ = nullptr;
+    size_ = 0;
+  }
+
+  void swap(BTree &other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(comp(), other.comp());
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    if constexpr (node_traits::propagate_on_container_swap::value)
+      std::swap(node_alloc_, other.node_alloc_);
+  }  // without propagation the allocators must compare equal
+
+  std::pair<iterator, bool> insert(const Key &value) {
+    return insert_unique(value);
+  }
+  std::pair<iterator, bool> insert(Key &&value) {
+    return insert_unique(std::move(value));
+  }
+
+  iterator insert_with_repetitions(const Key &value) {
+    return insert_equal(value);
+  }
+  iterator insert_with_repetitions(Key &&value) {
+    return insert_equal(std::move(value));
+  }  // equal keys keep their insertion order
+
+  void erase(iterator pos) {
+    Node *node = pos.node_;
+    if (node == nullptr) return;
+    const size_type i = pos.position_;
+    destroy_value(node->value(i));
+    if (!node->leaf_) {
+      Node *leaf = static_cast<Internal *>(node)->children_[i];
+      while (!leaf->leaf_)
+        leaf = static_cast<Internal *>(leaf)->children_[leaf->count_];
+      relocate(node, i, leaf, leaf->count_ - 1);
+      --leaf->count_;
+      node = leaf;
+    } else {
+      for (size_type j = i + 1; j < node->count_; ++j)
+        relocate(node, j - 1, node, j);
+      --node->count_;
+    }
+    --size_;
+    rebalance(node);
+  }  // an erased key in an inner node is replaced by its predecessor
+
+  // Moves every value whose key is missing here out of other; the values
+  // left behind are rebuilt in order, so other stays balanced.
+  void merge(BTree &other) {
+    if (this == &other) return;
+    BTree rest(other.comp(), other.get_allocator());
+    for (auto &item : other)
+      if (!insert_unique(std::move(item)).second) rest.append(std::move(item));
+    other.swap(rest);
+  }
+
+  void merge_with_repetitions(BTree &other) {
+    if (this == &other) return;
+    for (auto &item : other) insert_equal(std::move(item));
+    other.clear();
+  }  // equal keys from other are placed after the ones already here
+
+  // Replaces the contents with [first, last). Sorted input is appended in
+  // one pass with splits biased to leave full nodes behind; anything else is
+  // sorted first (stable, so the first of equal keys wins when unique is set).
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last, bool unique) {
+    using source_type = typename std::iterator_traits<InputIt>::value_type;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    auto less = [this](const Key &a, const Key &b) {
+      return comp()(key_of(a), key_of(b));
+    };
+    BTree fresh(comp(), get_allocator());
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category> &&
+                  std::is_same_v<source_type, std::remove_cv_t<Key>>) {
+      if (std::is_sorted(first, last, less)) {
+        const Key *previous = nullptr;
+        for (; first != last; ++first) {
+          const Key &item = *first;
+          if (!unique || previous == nullptr || less(*previous, item))
+            fresh.append(item);
+          previous = std::addressof(item);
+        }
+        swap(fresh);
+        return;
+      }
+      std::vector<const Key *> order;
+      for (; first != last; ++first) order.push_back(std::addressof(*first));
+      fresh.append_ordered(order, unique);
+    } else {
+      std::vector<Key> buffer(first, last);
+      std::vector<Key *> order;
+      order.reserve(buffer.size());
+      for (auto &item : buffer) order.push_back(std::addressof(item));
+      fresh.append_ordered(order, unique);
+    }
+    swap(fresh);
+  }
+
+  Key &at(const key_type &key) & {
+    auto it = find(key);
+    if (it != end()) return *it;
+    throw std::out_of_range("Key not found in BTree");
+  }
+  const Key &at(const key_type &key) const & {
+    auto it = find(key);
+    if (it != end()) return *it;
+    throw std::out_of_range("Key not found in BTree");
+  }
+
+  // Lookups take a key_type, or with a transparent Compare anything it can
+  // compare keys against.
+  iterator find(const key_type &key) noexcept { return find_equal(key); }
+  const_iterator find(const key_type &key) const noexcept {
+    return find_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return find_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return find_equal(key);
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    return find_equal(key) != end();
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return find_equal(key) != end();
+  }
+
+  iterator lower_bound(const key_type &key) noexcept {
+    return lower_position(key);
+  }
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return lower_position(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K &key) noexcept {
+    return lower_position(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return lower_position(key);
+  }
+
+  iterator upper_bound(const key_type &key) noexcept {
+    return upper_position(key);
+  }
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return upper_position(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K &key) noexcept {
+    return upper_position(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return upper_position(key);
+  }
+
+  std::pair<iterator, iterator> equal_range(const key_type &key) noexcept {
+    return {lower_position(key), upper_position(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const noexcept {
+    return {lower_position(key), upper_position(key)};
+  }
+
+  size_type count(const key_type &key) const noexcept {
+    return count_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) const noexcept {
+    return count_equal(key);
+  }  // O(log n + k), nodes carry no subtree sizes
+
+ private:
+  struct Node {
+    Internal *parent_;
+    std::uint16_t position_;  // index among the parent's children
+    std::uint16_t count_;     // values held
+    bool leaf_;
+    alignas(T) unsigned char storage_[sizeof(T) * kSlots];
+
+    explicit Node(bool leaf)
+        : parent_(nullptr), position_(0), count_(0), leaf_(leaf) {}
+
+    T *slot(size_type i) const noexcept {
+      return reinterpret_cast<T *>(const_cast<unsigned char *>(storage_) +
+                                   i * sizeof(T));
+    }  // raw storage, for constructing a value
+    T *value(size_type i) const noexcept { return std::launder(slot(i)); }
+  };
+
+  struct Internal : Node {
+    Node *children_[kSlots + 1] = {};  // count_ + 1 of them are in use
+
+    Internal() : Node(false) {}
+  };
+
+  Node *root_;
+  size_type size_;
+  node_allocator node_alloc_;
+
+  static const key_type &key_of(const Key &value) noexcept {
+    return KeyOfValue{}(value);
+  }
+
+  Node *create_leaf() {
+    Node *node = node_traits::allocate(node_alloc_, 1);
+    return ::new (static_cast<void *>(node)) Node(true);
+  }
+
+  Internal *create_internal() {
+    internal_allocator alloc(node_alloc_);
+    Internal *node = internal_traits::allocate(alloc, 1);
+    return ::new (static_cast<void *>(node)) Internal();
+  }
+
+  void free_node(Node *node) noexcept {
+    if (node->leaf_) {
+      node->~Node();
+      node_traits::deallocate(node_alloc_, node, 1);
+    } else {
+      internal_allocator alloc(node_alloc_);
+      auto *internal = static_cast<Internal *>(node);
+      internal->~Internal();
+      internal_traits::deallocate(alloc, internal, 1);
+    }
+  }  // the values must already be destroyed or moved out
+
+  template <class... Args>
+  void construct_value(T *where, Args &&...args) {
+    Allocator alloc(node_alloc_);
+    value_traits::construct(alloc, where, std::forward<Args>(args)...);
+  }
+
+  void destroy_value(T *value) noexcept {
+    Allocator alloc(node_alloc_);
+    value_traits::destroy(alloc, value);
+  }
+
+  void relocate(Node *to, size_type i, Node *from, size_type j) noexcept {
+    Allocator alloc(node_alloc_);
+    BinaryTree::Relocation<T>::relocate(alloc, to->slot(i), *from->value(j));
+  }
+
+  static void set_child(Internal *parent, size_type i, Node *child) noexcept {
+    parent->children_[i] = child;
+    child->parent_ = parent;
+    child->position_ = static_cast<std::uint16_t>(i);
+  }
+
+  void destroy_subtree(Node *node) noexcept {
+    if (!node->leaf_) {
+      auto *internal = static_cast<Internal *>(node);
+      for (size_type j = 0; j <= node->count_; ++j)
+        if (internal->children_[j] != nullptr)
+          destroy_subtree(internal->children_[j]);
+    }
+    for (size_type j = 0; j < node->count_; ++j) destroy_value(node->value(j));
+    free_node(node);
+  }
+
+  void copy_from(const BTree &other) {
+    if (other.root_ == nullptr) return;
+    root_ = clone_subtree(other.root_);
+    size_ = other.size_;
+  }  // expects an empty tree, copies the node layout as is
+
+  Node *clone_subtree(const Node *source) {
+    Node *copy = source->leaf_ ? create_leaf() : create_internal();
+    try {
+      while (copy->count_ < source->count_) {
+        construct_value(copy->slot(copy->count_),
+                        *source->value(copy->count_));
+        ++copy->count_;
+      }
+      if (!source->leaf_) {
+        auto *from = static_cast<const Internal *>(source);
+        for (size_type j = 0; j <= source->count_; ++j)
+          set_child(static_cast<Internal *>(copy), j,
+                    clone_subtree(from->children_[j]));
+      }
+    } catch (...) {
+      destroy_subtree(copy);
+      throw;
+    }
+    return copy;
+  }
+
+  template <class K>
+  size_type lower_index(const Node *node, const K &key) const noexcept {
+    size_type low = 0;
+    size_type high = node->count_;
+    while (low < high) {
+      const size_type mid = (low + high) / 2;
+      if (comp()(key_of(*node->value(mid)), key))
+        low = mid + 1;
+      else
+        high = mid;
+    }
+    return low;
+  }  // first value in node not less than key
+
+  template <class K>
+  size_type upper_index(const Node *node, const K &key) const noexcept {
+    size_type low = 0;
+    size_type high = node->count_;
+    while (low < high) {
+      const size_type mid = (low + high) / 2;
+      if (comp()(key, key_of(*node->value(mid))))
+        high = mid;
+      else
+        low = mid + 1;
+    }
+    return low;
+  }  // first value in node greater than key
+
+  template <class K>
+  iterator lower_position(const K &key) const noexcept {
+    iterator result(nullptr, 0);
+    for (Node *node = root_; node != nullptr;) {
+      const size_type i = lower_index(node, key);
+      if (i < node->count_) result = iterator(node, i);
+      if (node->leaf_) break;
+      node = static_cast<Internal *>(node)->children_[i];
+    }
+    return result;
+  }
+
+  template <class K>
+  iterator upper_position(const K &key) const noexcept {
+    iterator result(nullptr, 0);
+    for (Node *node = root_; node != nullptr;) {
+      const size_type i = upper_index(node, key);
+      if (i < node->count_) result = iterator(node, i);
+      if (node->leaf_) break;
+      node = static_cast<Internal *>(node)->children_[i];
+    }
+    return result;
+  }
+
+  template <class K>
+  iterator find_equal(const K &key) const noexcept {
+    iterator it = lower_position(key);
+    if (it.node_ != nullptr && comp()(key, key_of(*it)))
+      return iterator(nullptr, 0);
+    return it;
+  }  // first of the equal keys, so duplicates can be walked forwards
+
+  template <class K>
+  size_type count_equal(const K &key) const noexcept {
+    size_type result = 0;
+    for (const_iterator it = lower_position(key), last = upper_position(key);
+         it != last; ++it)
+      ++result;
+    return result;
+  }
+
+  template <class V>
+  std::pair<iterator, bool> insert_unique(V &&value) {
+    const key_type &key = key_of(value);
+    if (root_ == nullptr) root_ = create_leaf();
+    for (Node *node = root_;;) {
+      const size_type i = lower_index(node, key);
+      if (i < node->count_ && !comp()(key, key_of(*node->value(i))))
+        return {iterator(node, i), false};
+      if (node->leaf_)
+        return {emplace_at(node, i, std::forward<V>(value)), true};
+      node = static_cast<Internal *>(node)->children_[i];
+    }
+  }
+
+  template <class V>
+  iterator insert_equal(V &&value) {
+    const key_type &key = key_of(value);
+    if (root_ == nullptr) root_ = create_leaf();
+    Node *node = root_;
+    while (!node->leaf_)
+      node = static_cast<Internal *>(node)->children_[upper_index(node, key)];
+    return emplace_at(node, upper_index(node, key), std::forward<V>(value));
+  }
+
+  template <class V>
+  void append(V &&value) {
+    if (root_ == nullptr) root_ = create_leaf();
+    Node *node = root_;
+    while (!node->leaf_)
+      node = static_cast<Internal *>(node)->children_[node->count_];
+    emplace_at(node, node->count_, std::forward<V>(value));
+  }  // value must not be ordered before the current last one
+
+  template <class Pointer>
+  void append_ordered(std::vector<Pointer> &order, bool unique) {
+    std::stable_sort(order.begin(), order.end(), [this](Pointer a, Pointer b) {
+      return comp()(key_of(*a), key_of(*b));
+    });
+    Pointer previous = nullptr;
+    for (Pointer item : order) {
+      if (!unique || previous == nullptr ||
+          comp()(key_of(*previous), key_of(*item))) {
+        if constexpr (std::is_const_v<std::remove_pointer_t<Pointer>>)
+          append(*item);
+        else
+          append(std::move(*item));
+      }
+      previous = item;
+    }
+  }  // sorts pointers so the source elements themselves never move
+
+  template <class... Args>
+  iterator emplace_at(Node *node, size_type pos, Args &&...args) {
+    std::tie(node, pos) = make_room(node, pos);
+    for (size_type j = node->count_; j > pos; --j)
+      relocate(node, j, node, j - 1);
+    try {
+      construct_value(node->slot(pos), std::forward<Args>(args)...);
+    } catch (...) {
+      for (size_type j = pos; j < node->count_; ++j)
+        relocate(node, j, node, j + 1);
+      throw;
+    }
+    ++node->count_;
+    ++size_;
+    return iterator(node, pos);
+  }
+
+  // Makes sure node can take one more value at pos, splitting it (and its
+  // ancestors when they are full too) and returning where pos ended up.
+  std::pair<Node *, size_type> make_room(Node *node, size_type pos) {
+    if (node->count_ < kSlots) return {node, pos};
+    if (node->parent_ == nullptr) {
+      Internal *root = create_internal();
+      set_child(root, 0, node);
+      root_ = root;
+    } else {
+      make_room(node->parent_, node->position_);
+    }
+    Node *right = node->leaf_ ? create_leaf() : create_internal();
+    Internal *parent = node->parent_;
+    const size_type mid = pos == kSlots ? kSlots - 1 : kSlots / 2;
+    const size_type moved = kSlots - mid - 1;
+    for (size_type j = 0; j < moved; ++j) relocate(right, j, node, mid + 1 + j);
+    if (!node->leaf_) {
+      auto *from = static_cast<Internal *>(node);
+      for (size_type j = 0; j <= moved; ++j)
+        set_child(static_cast<Internal *>(right), j,
+                  from->children_[mid + 1 + j]);
+    }
+    right->count_ = static_cast<std::uint16_t>(moved);
+    const size_type at = node->position_;
+    for (size_type j = parent->count_; j > at; --j) {
+      relocate(parent, j, parent, j - 1);
+      set_child(parent, j + 1, parent->children_[j]);
+    }
+    relocate(parent, at, node, mid);
+    set_child(parent, at + 1, right);
+    ++parent->count_;
+    node->count_ = static_cast<std::uint16_t>(mid);
+    if (pos <= mid) return {node, pos};
+    return {right, pos - mid - 1};
+  }
+
+  // Restores the minimum fill of node after a removal by borrowing from a
+  // sibling or merging with one, walking up while parents underflow.
+  void rebalance(Node *node) noexcept {
+    while (node != root_) {
+      if (node->count_ >= kMinSlots) return;
+      Internal *parent = node->parent_;
+      const size_type at = node->position_;
+      Node *left = at > 0 ? parent->children_[at - 1] : nullptr;
+      Node *right = at < parent->count_ ? parent->children_[at + 1] : nullptr;
+      if (left != nullptr && left->count_ > kMinSlots) {
+        rotate_right(parent, at - 1);
+        return;
+      }
+      if (right != nullptr && right->count_ > kMinSlots) {
+        rotate_left(parent, at);
+        return;
+      }
+      merge_children(parent, left != nullptr ? at - 1 : at);
+      node = parent;
+    }
+    if (root_->count_ > 0) return;
+    Node *old_root = root_;
+    if (old_root->leaf_) {
+      root_ = nullptr;
+    } else {
+      root_ = static_cast<Internal *>(old_root)->children_[0];
+      root_->parent_ = nullptr;
+      root_->position_ = 0;
+    }
+    free_node(old_root);
+  }
+
+  void rotate_right(Internal *parent, size_type i) noexcept {
+    Node *left = parent->children_[i];
+    Node *right = parent->children_[i + 1];
+    for (size_type j = right->count_; j > 0; --j)
+      relocate(right, j, right, j - 1);
+    relocate(right, 0, parent, i);
+    relocate(parent, i, left, left->count_ - 1);
+    if (!right->leaf_) {
+      auto *to = static_cast<Internal *>(right);
+      for (size_type j = right->count_ + 1; j > 0; --j)
+        set_child(to, j, to->children_[j - 1]);
+      set_child(to, 0, static_cast<Internal *>(left)->children_[left->count_]);
+    }
+    --left->count_;
+    ++right->count_;
+  }  // moves one value from the left child through the parent to the right
+
+  void rotate_left(Internal *parent, size_type i) noexcept {
+    Node *left = parent->children_[i];
+    Node *right = parent->children_[i + 1];
+    relocate(left, left->count_, parent, i);
+    relocate(parent, i, right, 0);
+    for (size_type j = 1; j < right->count_; ++j)
+      relocate(right, j - 1, right, j);
+    if (!left->leaf_) {
+      auto *from = static_cast<Internal *>(right);
+      set_child(static_cast<Internal *>(left), left->count_ + 1,
+                from->children_[0]);
+      for (size_type j = 0; j < right->count_; ++j)
+        set_child(from, j, from->children_[j + 1]);
+    }
+    ++left->count_;
+    --right->count_;
+  }  // moves one value from the right child through the parent to the left
+
+  void merge_children(Internal *parent, size_type i) noexcept {
+    Node *left = parent->children_[i];
+    Node *right = parent->children_[i + 1];
+    const size_type base = left->count_;
+    relocate(left, base, parent, i);
+    for (size_type j = 0; j < right->count_; ++j)
+      relocate(left, base + 1 + j, right, j);
+    if (!left->leaf_) {
+      auto *from = static_cast<Internal *>(right);
+      for (size_type j = 0; j <= right->count_; ++j)
+        set_child(static_cast<Internal *>(left), base + 1 + j,
+                  from->children_[j]);
+    }
+    left->count_ = static_cast<std::uint16_t>(base + 1 + right->count_);
+    for (size_type j = i + 1; j < parent->count_; ++j) {
+      relocate(parent, j - 1, parent, j);
+      set_child(parent, j, parent->children_[j + 1]);
+    }
+    --parent->count_;
+    right->count_ = 0;
+    free_node(right);
+  }  // folds the right child and the separating value into the left child
+};
+}  // namespace BTree
+
+#endif  // CPP2_S21_CONTAINERS_1_BTREE_H
@@ -5,20 +5,120 @@
 #ifndef CPP2_S21_CONTAINERS_1_BINARYTREE_H
 #define CPP2_S21_CONTAINERS_1_BINARYTREE_H
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../s21_node_pool.h"
 
 namespace BinaryTree {
 
-template <class T, class Compare = std::less<T>>
-class BinaryTree {
+// Key extractors. The tree orders its values by KeyOfValue{}(value), so a map
+// is searched by its key alone instead of by a whole pair.
+struct Identity {
+  template <class T>
+  const T &operator()(const T &value) const noexcept {
+    return value;
+  }
+};
+
+struct SelectFirst {
+  template <class Pair>
+  const typename Pair::first_type &operator()(
+      const Pair &value) const noexcept {
+    return value.first;
+  }
+};
+
+// Moves a stored value into raw storage and destroys the original, for
+// containers that shift values between slots. A map stores
+// pair<const Key, T>, and moving that as a whole copies the key, so its
+// members are handed over one by one with the key's const cast away; the
+// key is never read again before it is destroyed.
+template <class T>
+struct Relocation {
+  static constexpr bool kNothrow = std::is_nothrow_move_constructible_v<T>;
+
+  template <class Alloc>
+  static void relocate(Alloc &alloc, T *to, T &from) noexcept(kNothrow) {
+    std::allocator_traits<Alloc>::construct(alloc, to, std::move(from));
+    std::allocator_traits<Alloc>::destroy(alloc, std::addressof(from));
+  }
+};
+
+template <class Key, class T>
+struct Relocation<std::pair<const Key, T>> {
+  static constexpr bool kNothrow = std::is_nothrow_move_constructible_v<Key> &&
+                                   std::is_nothrow_move_constructible_v<T>;
+
+  template <class Alloc>
+  static void relocate(Alloc &alloc, std::pair<const Key, T> *to,
+                       std::pair<const Key, T> &from) noexcept(kNothrow) {
+    std::allocator_traits<Alloc>::construct(
+        alloc, to, std::move(const_cast<Key &>(from.first)),
+        std::move(from.second));
+    std::allocator_traits<Alloc>::destroy(alloc, std::addressof(from));
+  }
+};
+
+// Holds the tree's comparator. A stateless, non-final comparator becomes a
+// base class, so it takes no space in the tree (empty base optimisation).
+template <class Compare,
+          bool = std::is_empty_v<Compare> && !std::is_final_v<Compare>>
+class CompareHolder : private Compare {
+ public:
+  explicit CompareHolder(const Compare &comp) : Compare(comp) {}
+
+  const Compare &comp() const noexcept { return *this; }
+  Compare &comp() noexcept { return *this; }
+};
+
+template <class Compare>
+class CompareHolder<Compare, false> {
+ public:
+  explicit CompareHolder(const Compare &comp) : comp_(comp) {}
+
+  const Compare &comp() const noexcept { return comp_; }
+  Compare &comp() noexcept { return comp_; }
+
+ private:
+  Compare comp_;
+};
+
+template <class T, class Compare = std::less<T>,
+          class Allocator = s21::PoolAllocator<T>, class KeyOfValue = Identity>
+class BinaryTree : private CompareHolder<Compare> {
  private:
   struct Node;
+  using compare_holder = CompareHolder<Compare>;
+  using compare_holder::comp;
+  using value_traits = std::allocator_traits<Allocator>;
+  using node_allocator = typename value_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
 
  public:
   using Key = T;
+  using key_type = std::remove_cv_t<std::remove_reference_t<decltype(
+      KeyOfValue{}(std::declval<const T &>()))>>;
   using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
 
   struct iterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Key *;
+    using reference = Key &;
+
     Node *node_;
 
     explicit iterator(Node *node) : node_(node) {}
@@ -66,6 +166,12 @@ class BinaryTree {
   };
 
   struct const_iterator {
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key *;
+    using reference = const Key &;
+
     const Node *node_;
 
     explicit const_iterator(Node *node) : node_(node) {}
@@ -112,57 +218,190 @@ class BinaryTree {
     const Key &operator*() const & { return node_->key_; }
   };
 
-  BinaryTree() noexcept : root_(nullptr), size_(0) {}
-  explicit BinaryTree(std::initializer_list<Key> const &items)
-      : root_(nullptr), size_(0) {
-    for (const auto &item : items) insert(item);
+  BinaryTree() : BinaryTree(Compare(), Allocator()) {}
+  explicit BinaryTree(const allocator_type &alloc)
+      : BinaryTree(Compare(), alloc) {}
+  explicit BinaryTree(const Compare &comp,
+                      const allocator_type &alloc = allocator_type())
+      : compare_holder(comp), root_(nullptr), size_(0), node_alloc_(alloc) {}
+  explicit BinaryTree(std::initializer_list<Key> const &items,
+                      const allocator_type &alloc = allocator_type())
+      : BinaryTree(items, Compare(), alloc) {}
+  BinaryTree(std::initializer_list<Key> const &items, const Compare &comp,
+             const allocator_type &alloc = allocator_type())
+      : BinaryTree(comp, alloc) {
+    assign_sorted(items.begin(), items.end(), true);
   }
-  BinaryTree(const BinaryTree &other) : root_(nullptr), size_(0) {
-    *this = other;
+  BinaryTree(const BinaryTree &other)
+      : BinaryTree(other.comp(),
+                   node_traits::select_on_container_copy_construction(
+                       other.node_alloc_)) {
+    copy_from(other);
   }
-  BinaryTree(BinaryTree &&other) noexcept
-      : root_(other.root_), size_(other.size_) {
+  BinaryTree(BinaryTree &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Compare>)
+      : compare_holder(other.comp()),
+        root_(other.root_),
+        size_(other.size_),
+        node_alloc_(std::move(other.node_alloc_)) {
     other.root_ = nullptr;
     other.size_ = 0;
-  }
+  }  // the comparator is copied, other stays usable
 
   ~BinaryTree() { clear(); }
 
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(node_alloc_);
+  }
+
+  key_compare key_comp() const { return comp(); }
+
   std::pair<iterator, bool> insert(const Key &value) {
-    auto new_node = new Node(value);
+    auto new_node = create_node(value);
     auto is_insert = insert(new_node);
     if (is_insert) {
       return std::make_pair(iterator(new_node), is_insert);
     } else {
-      delete new_node;
-      return std::make_pair(find(value), is_insert);
+      destroy_node(new_node);
+      return std::make_pair(find(key_of(value)), is_insert);
     }
   }
 
   std::pair<iterator, bool> insert_or_assign(const Key &key) {
-    auto new_node = new Node(key);
+    auto new_node = create_node(key);
     auto is_insert = insert(new_node);
     if (!is_insert) {
-      auto it = find(key);
+      auto it = find(key_of(key));
       erase(it);
       insert(new_node);
     }
     return std::make_pair(iterator(new_node), is_insert);
   }
 
-  void merge(BinaryTree<Key, Compare> &other) {
+  // Owns a node taken out of a tree, so it can be inserted elsewhere without
+  // reallocating or copying the key.
+  class node_type {
+   public:
+    using value_type = Key;
+    using allocator_type = Allocator;
+
+    node_type() noexcept = default;
+    node_type(node_type &&other) noexcept
+        : node_(other.node_), alloc_(std::move(other.alloc_)) {
+      other.node_ = nullptr;
+      other.alloc_.reset();
+    }
+    node_type &operator=(node_type &&other) noexcept {
+      if (this != &other) {
+        reset();
+        node_ = other.node_;
+        alloc_ = std::move(other.alloc_);
+        other.node_ = nullptr;
+        other.alloc_.reset();
+      }
+      return *this;
+    }
+    ~node_type() { reset(); }
+
+    [[nodiscard]] bool empty() const noexcept { return node_ == nullptr; }
+    explicit operator bool() const noexcept { return node_ != nullptr; }
+    value_type &value() const noexcept { return node_->key_; }
+    allocator_type get_allocator() const { return allocator_type(*alloc_); }
+
+    void swap(node_type &other) noexcept {
+      std::swap(node_, other.node_);
+      std::swap(alloc_, other.alloc_);
+    }
+
+   private:
+    friend class BinaryTree;
+
+    node_type(Node *node, const node_allocator &alloc)
+        : node_(node), alloc_(alloc) {}
+
+    Node *release() noexcept {
+      Node *node = node_;
+      node_ = nullptr;
+      alloc_.reset();
+      return node;
+    }
+
+    void reset() noexcept {
+      if (node_ != nullptr) destroy_node(*alloc_, node_);
+      node_ = nullptr;
+      alloc_.reset();
+    }
+
+    Node *node_ = nullptr;
+    std::optional<node_allocator> alloc_;
+  };
+
+  struct insert_return_type {
+    iterator position;
+    bool inserted;
+    node_type node;
+  };
+
+  node_type extract(iterator pos) noexcept {
+    if (pos.node_ == nullptr) return node_type();
+    return node_type(detach(pos.node_), node_alloc_);
+  }
+
+  node_type extract(const key_type &key) {
+    return extract(find(key));
+  }  // not noexcept, the lookup runs the user's comparator
+
+  insert_return_type insert(node_type &&handle) {
+    if (handle.empty()) return {end(), false, node_type()};
+    auto [slot, exists] = find_slot(key_of(handle.node_->key_));
+    if (exists) return {iterator(slot), false, std::move(handle)};
+    Node *node = handle.release();
+    link_at(node, slot);
+    return {iterator(node), true, node_type()};
+  }  // the handle must come from a tree with an equal allocator
+
+  iterator insert_with_repetitions(node_type &&handle) {
+    if (handle.empty()) return end();
+    Node *node = handle.release();
+    link_with_repetitions(node);
+    return iterator(node);
+  }
+
+  // Moves every node whose key is missing here out of other. Nodes are
+  // relinked, not copied, unless the allocators differ.
+  void merge(BinaryTree &other) {
+    if (this == &other) return;
     for (auto it = other.begin(); it != other.end();) {
-      auto new_node = new Node(*it);
       auto next_it = it;
       ++next_it;
-      if (insert(new_node))
-        other.erase(it);
-      else
-        delete new_node;
+      auto [slot, exists] = find_slot(key_of(*it));
+      if (!exists) {
+        if (node_alloc_ == other.node_alloc_) {
+          link_at(other.detach(it.node_), slot);
+        } else {
+          link_at(create_node(*it), slot);
+          other.erase(it);
+        }
+      }
       it = next_it;
     }
   }
 
+  void merge_with_repetitions(BinaryTree &other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end();) {
+      auto next_it = it;
+      ++next_it;
+      if (node_alloc_ == other.node_alloc_) {
+        link_with_repetitions(other.detach(it.node_));
+      } else {
+        link_with_repetitions(create_node(*it));
+        other.erase(it);
+      }
+      it = next_it;
+    }
+  }  // equal keys from other are placed after the ones already here
+
   iterator begin() noexcept {
     if (root_ == nullptr) return iterator(nullptr);
     Node *current = root_;
@@ -182,109 +421,69 @@ class BinaryTree {
 
   void erase(iterator pos) noexcept {
     if (pos.node_ == nullptr) return;
-    if (pos.node_->left_ == nullptr) {
-      if (pos.node_->parent_ == nullptr) {
-        root_ = pos.node_->right_;
-        if (root_ != nullptr) root_->parent_ = nullptr;
-      } else {
-        if (pos.node_->parent_->left_ == pos.node_)
-          pos.node_->parent_->left_ = pos.node_->right_;
-        else
-          pos.node_->parent_->right_ = pos.node_->right_;
-        if (pos.node_->right_ != nullptr)
-          pos.node_->right_->parent_ = pos.node_->parent_;
-      }
-      delete pos.node_;
-      --size_;
-    } else if (pos.node_->right_ == nullptr) {
-      if (pos.node_->parent_ == nullptr) {
-        root_ = pos.node_->left_;
-        root_->parent_ = nullptr;
-      } else {
-        if (pos.node_->parent_->left_ == pos.node_) {
-          pos.node_->parent_->left_ = pos.node_->left_;
-          pos.node_->left_->parent_ = pos.node_->parent_;
-        } else {
-          pos.node_->parent_->right_ = pos.node_->left_;
-          pos.node_->left_->parent_ = pos.node_->parent_;
-        }
-      }
-      delete pos.node_;
-      --size_;
-    } else {
-      Node *successor = pos.node_->right_;
-      while (successor->left_ != nullptr) {
-        successor = successor->left_;
-      }
-      auto new_node = new Node(successor->key_, pos.node_->left_,
-                               pos.node_->right_, pos.node_->parent_);
-      if (pos.node_->left_ != nullptr) pos.node_->left_->parent_ = new_node;
-      if (pos.node_->right_ != nullptr) pos.node_->right_->parent_ = new_node;
-      delete pos.node_;
-      pos.node_ = new_node;
-      if (new_node->parent_ == nullptr) root_ = new_node;
-      erase(iterator(successor));
-    }
-  }
+    destroy_node(detach(pos.node_));
+  }  // only the erased node is freed, other iterators stay valid
 
-  Key &at(const Key &key) & {
+  Key &at(const key_type &key) & {
     auto it = find(key);
     if (it != end()) return (*it);
     throw std::out_of_range("Key not found in BinaryTree");
   }
 
-  const Key &at(const Key &key) const & {
+  const Key &at(const key_type &key) const & {
     auto it = find(key);
     if (it != end()) return (*it);
     throw std::out_of_range("Key not found in BinaryTree");
   }
 
-  iterator find(const Key &key) noexcept {
-    auto cmp = Compare{};
-    auto current = root_;
-    while (current && (cmp(current->key_, key) || cmp(key, current->key_))) {
-      if (cmp(current->key_, key))
-        current = current->right_;
-      else
-        current = current->left_;
-    }
-    if (current == nullptr)
-      return iterator(nullptr);
-    else
-      return iterator(current);
+  // Lookups take a key_type, or with a transparent Compare (one declaring
+  // is_transparent, like std::less<>) anything it can compare keys against.
+  iterator find(const key_type &key) noexcept {
+    return iterator(find_node(key));
   }
-
-  const_iterator find(const Key &key) const noexcept {
-    auto cmp = Compare{};
-    auto current = root_;
-    while (current && (cmp(current->key_, key) || cmp(key, current->key_))) {
-      if (cmp(current->key_, key))
-        current = current->right_;
-      else
-        current = current->left_;
-    }
-    if (current == nullptr)
-      return const_iterator(nullptr);
-    else
-      return const_iterator(current);
+  const_iterator find(const key_type &key) const noexcept {
+    return const_iterator(find_node(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return iterator(find_node(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return const_iterator(find_node(key));
   }
 
-  bool contains(const Key &key) const noexcept { return find(key) != end(); }
+  bool contains(const key_type &key) const noexcept {
+    return find_node(key) != nullptr;
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return find_node(key) != nullptr;
+  }
 
   void clear() noexcept {
-    iterator it = begin();
-    while (it != end()) {
-      iterator current = it;
-      ++it;
-      erase(current);
+    Node *node = root_;
+    while (node != nullptr) {
+      if (node->left_ != nullptr) {
+        Node *left = node->left_;
+        node->left_ = left->right_;
+        left->right_ = node;
+        node = left;
+      } else {
+        Node *next = node->right_;
+        destroy_node(node);
+        node = next;
+      }
     }
     root_ = nullptr;
-  }
+    size_ = 0;
+  }  // rotates left subtrees into a right spine and frees it in key order,
+     // O(n) without recursion or parent fix-ups
 
-  Key &operator[](const Key &key) &noexcept {
-    auto it = find(key);
+  Key &operator[](const Key &key) & {
+    auto it = find(key_of(key));
     if (it != end()) return *it;
-    auto new_node = new Node(key);
+    auto new_node = create_node(key);
     insert(new_node);
     return new_node->key_;
   }
@@ -292,16 +491,28 @@ class BinaryTree {
   BinaryTree &operator=(const BinaryTree &other) & {
     if (this == &other) return *this;
     clear();
-    for (const auto &item : other) {
-      insert_with_repetitions(item);
-    }
-    size_ = other.size_;
+    comp() = other.comp();
+    if constexpr (node_traits::propagate_on_container_copy_assignment::value)
+      node_alloc_ = other.node_alloc_;
+    copy_from(other);
     return *this;
   }
 
-  BinaryTree &operator=(BinaryTree &&other) &noexcept {
+  BinaryTree &operator=(BinaryTree &&other) &noexcept(
+      (node_traits::propagate_on_container_move_assignment::value ||
+       node_traits::is_always_equal::value) &&
+      std::is_nothrow_copy_assignable_v<Compare>) {
     if (this == &other) return *this;
     clear();
+    comp() = other.comp();
+    if constexpr (node_traits::propagate_on_container_move_assignment::
+                      value) {
+      node_alloc_ = std::move(other.node_alloc_);
+    } else if (node_alloc_ != other.node_alloc_) {
+      for (const auto &item : other) insert_with_repetitions(item);
+      other.clear();
+      return *this;
+    }
     root_ = other.root_;
     size_ = other.size_;
     other.root_ = nullptr;
@@ -309,136 +520,629 @@ class BinaryTree {
     return *this;
   }
 
+  // Replaces the contents with [first, last) in O(n) when the range is
+  // already sorted, otherwise sorts it first (stable, so the first of equal
+  // keys wins when unique is set). The tree is built balanced in one pass.
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last, bool unique) {
+    using source_type = typename std::iterator_traits<InputIt>::value_type;
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    auto less = [this](const Key &a, const Key &b) {
+      return comp()(key_of(a), key_of(b));
+    };
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category> &&
+                  std::is_same_v<source_type, std::remove_cv_t<Key>>) {
+      if (std::is_sorted(first, last, less)) {
+        build_sorted(first, last, unique,
+                     [](const InputIt &it) -> const Key & { return *it; });
+        return;
+      }
+      std::vector<const Key *> order;
+      for (; first != last; ++first) order.push_back(std::addressof(*first));
+      build_ordered(order, unique);
+    } else {
+      std::vector<Key> buffer(first, last);
+      std::vector<Key *> order;
+      order.reserve(buffer.size());
+      for (auto &item : buffer) order.push_back(std::addressof(item));
+      build_ordered(order, unique);
+    }
+  }
+
+  void swap(BinaryTree &other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(comp(), other.comp());
+    std::swap(root_, other.root_);
+    std::swap(size_, other.size_);
+    if constexpr (node_traits::propagate_on_container_swap::value)
+      std::swap(node_alloc_, other.node_alloc_);
+  }  // without propagation the allocators must compare equal
+
   [[nodiscard]] bool empty() const noexcept { return root_ == nullptr; }
   [[nodiscard]] size_type size() const { return size_; }
   [[nodiscard]] size_type max_size() const {
-    return SIZE_MAX / sizeof(Node) / 2;
+    return std::min<size_type>(SIZE_MAX / sizeof(Node) / 2,
+                               node_traits::max_size(node_alloc_));
   }
 
   iterator insert_with_repetitions(const Key &key) {
-    auto new_node = new Node(key);
-    auto cmp = Compare{};
-    if (root_ == nullptr) {
-      root_ = new_node;
-      ++size_;
-      return iterator(new_node);
-    }
-    Node *current = root_;
-    Node *parent = root_;
-    while (current != nullptr) {
-      parent = current;
-      if (cmp(new_node->key_, current->key_))
-        current = current->left_;
-      else
-        current = current->right_;
-    }
-    if (cmp(new_node->key_, parent->key_))
-      parent->left_ = new_node;
-    else
-      parent->right_ = new_node;
-    new_node->parent_ = parent;
-    ++size_;
+    auto new_node = create_node(key);
+    link_with_repetitions(new_node);
     return iterator(new_node);
   }
 
-  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
-    auto last = find(key);
-    auto first = last;
-    while (last != end()) {
-      if (Compare{}(*last, key) || Compare{}(key, *last)) break;
-      ++last;
-    }
-    return std::make_pair(first, last);
+  std::pair<iterator, iterator> equal_range(const key_type &key) noexcept {
+    return std::make_pair(lower_bound(key), upper_bound(key));
   }
-
   std::pair<const_iterator, const_iterator> equal_range(
-      const Key &key) const noexcept {
-    auto last = find(key);
-    auto first = last;
-    while (last != end()) {
-      if (Compare{}(*last, key) || Compare{}(key, *last)) break;
-      ++last;
-    }
-    return std::make_pair(first, last);
+      const key_type &key) const noexcept {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key) noexcept {
+    return std::make_pair(lower_bound(key), upper_bound(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  std::pair<const_iterator, const_iterator> equal_range(
+      const K &key) const noexcept {
+    return std::make_pair(lower_bound(key), upper_bound(key));
   }
 
-  iterator lower_bound(const Key &key) noexcept {
-    auto current = root_;
-    while (current != nullptr && Compare{}(current->key_, key))
-      current = current->right_;
-    return iterator(current);
+  iterator lower_bound(const key_type &key) noexcept {
+    return iterator(lower_node(key));
   }
-  const_iterator lower_bound(const Key &key) const noexcept {
-    auto current = root_;
-    while (current != nullptr && Compare{}(current->key_, key))
-      current = current->right_;
-    return const_iterator(current);
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return const_iterator(lower_node(key));
   }
-  iterator upper_bound(const Key &key) noexcept {
-    auto current = root_;
-    while (current != nullptr && !Compare{}(key, current->key_))
-      current = current->right_;
-    return iterator(current);
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator lower_bound(const K &key) noexcept {
+    return iterator(lower_node(key));
   }
-  const_iterator upper_bound(const Key &key) const noexcept {
-    auto current = root_;
-    while (current != nullptr && !Compare{}(key, current->key_))
-      current = current->right_;
-    return const_iterator(current);
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator lower_bound(const K &key) const noexcept {
+    return const_iterator(lower_node(key));
   }
 
-  size_type count(const Key &key) const noexcept {
-    auto it = find(key);
-    size_type result = 0;
-    while (it != end() && !(Compare{}(*it, key) || Compare{}(key, *it))) {
-      ++result;
-      ++it;
-    }
-    return result;
+  iterator upper_bound(const key_type &key) noexcept {
+    return iterator(upper_node(key));
+  }
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return const_iterator(upper_node(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator upper_bound(const K &key) noexcept {
+    return iterator(upper_node(key));
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator upper_bound(const K &key) const noexcept {
+    return const_iterator(upper_node(key));
   }
 
+  size_type count(const key_type &key) const noexcept {
+    return count_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) const noexcept {
+    return count_equal(key);
+  }
+
+  // Order statistics, all O(log n) through the subtree sizes.
+  iterator nth_element(size_type k) noexcept {
+    return iterator(select_node(k));
+  }
+  const_iterator nth_element(size_type k) const noexcept {
+    return const_iterator(select_node(k));
+  }  // the k-th key in order counting from zero, end() when k >= size()
+
+  size_type rank(const key_type &key) const noexcept {
+    return count_less(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type rank(const K &key) const noexcept {
+    return count_less(key);
+  }  // keys ordered before key, the index lower_bound(key) points at
+
+  size_type count_range(const key_type &lo, const key_type &hi) const noexcept {
+    return range_size(lo, hi);
+  }
+  template <class K1, class K2, class C = Compare,
+            class = typename C::is_transparent>
+  size_type count_range(const K1 &lo, const K2 &hi) const noexcept {
+    return range_size(lo, hi);
+  }  // keys in the half-open range [lo, hi), zero unless lo < hi
+
  private:
   struct Node {
-    Key key_;
+    union {
+      Key key_;  // constructed through the value allocator
+    };
     Node *left_;
     Node *right_;
     Node *parent_;
+    size_type weight_;  // nodes in the subtree rooted here, itself included
+    bool red_;
 
-    explicit Node(Key key, Node *left = nullptr, Node *right = nullptr,
-                  Node *parent = nullptr)
-        : key_(key), left_(left), right_(right), parent_(parent) {}
+    Node()
+        : left_(nullptr),
+          right_(nullptr),
+          parent_(nullptr),
+          weight_(1),
+          red_(true) {}
+    ~Node() {}
   };
 
   Node *root_;
   size_type size_;
+  node_allocator node_alloc_;
 
-  bool insert(Node *new_node) noexcept {
-    auto cmp = Compare{};
+  static const key_type &key_of(const Key &value) noexcept {
+    return KeyOfValue{}(value);
+  }
+
+  template <typename... Args>
+  Node *create_node(Args &&...args) {
+    Node *node = node_traits::allocate(node_alloc_, 1);
+    ::new (static_cast<void *>(node)) Node();
+    try {
+      Allocator alloc(node_alloc_);
+      value_traits::construct(alloc, std::addressof(node->key_),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(node_alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroy_node(Node *node) noexcept { destroy_node(node_alloc_, node); }
+
+  static void destroy_node(node_allocator &node_alloc, Node *node) noexcept {
+    Allocator alloc(node_alloc);
+    value_traits::destroy(alloc, std::addressof(node->key_));
+    node->~Node();
+    node_traits::deallocate(node_alloc, node, 1);
+  }
+
+  Node *detach(Node *node) noexcept {
+    if (node->left_ != nullptr && node->right_ != nullptr)
+      unlink_with_successor(node);
+    else
+      unlink(node);
+    --size_;
+    node->left_ = node->right_ = node->parent_ = nullptr;
+    node->weight_ = 1;
+    node->red_ = true;
+    return node;
+  }  // takes a node out of the tree without freeing it
+
+  void link_with_repetitions(Node *new_node) noexcept {
+    const Compare &cmp = comp();
     if (root_ == nullptr) {
       root_ = new_node;
+      root_->red_ = false;
       ++size_;
-      return true;
+      return;
     }
     Node *current = root_;
     Node *parent = root_;
     while (current != nullptr) {
       parent = current;
-      if (!(cmp(new_node->key_, current->key_) ||
-            cmp(current->key_, new_node->key_)))
-        return false;
-      if (cmp(new_node->key_, current->key_))
+      if (cmp(key_of(new_node->key_), key_of(current->key_)))
         current = current->left_;
       else
         current = current->right_;
     }
-    if (cmp(new_node->key_, parent->key_))
+    if (cmp(key_of(new_node->key_), key_of(parent->key_)))
       parent->left_ = new_node;
     else
       parent->right_ = new_node;
     new_node->parent_ = parent;
+    add_weight(parent, 1);
+    insert_fixup(new_node);
     ++size_;
+  }
+
+  bool insert(Node *new_node) noexcept {
+    auto [slot, exists] = find_slot(key_of(new_node->key_));
+    if (exists) return false;
+    link_at(new_node, slot);
     return true;
   }
+
+  std::pair<Node *, bool> find_slot(const key_type &key) const noexcept {
+    const Compare &cmp = comp();
+    Node *parent = nullptr;
+    for (Node *current = root_; current != nullptr;) {
+      parent = current;
+      if (cmp(key, key_of(current->key_)))
+        current = current->left_;
+      else if (cmp(key_of(current->key_), key))
+        current = current->right_;
+      else
+        return {current, true};
+    }
+    return {parent, false};
+  }  // the node holding key, or the parent a new key would hang from
+
+  void link_at(Node *new_node, Node *parent) noexcept {
+    new_node->parent_ = parent;
+    if (parent == nullptr) {
+      root_ = new_node;
+      root_->red_ = false;
+    } else {
+      if (comp()(key_of(new_node->key_), key_of(parent->key_)))
+        parent->left_ = new_node;
+      else
+        parent->right_ = new_node;
+      add_weight(parent, 1);
+      insert_fixup(new_node);
+    }
+    ++size_;
+  }
+
+  template <class Pointer>
+  void build_ordered(std::vector<Pointer> &order, bool unique) {
+    std::stable_sort(order.begin(), order.end(),
+                     [this](Pointer a, Pointer b) {
+                       return comp()(key_of(*a), key_of(*b));
+                     });
+    build_sorted(order.begin(), order.end(), unique,
+                 [](const auto &it) -> decltype(auto) {
+                   if constexpr (std::is_const_v<
+                                     std::remove_pointer_t<Pointer>>)
+                     return **it;
+                   else
+                     return std::move(**it);
+                 });
+  }  // sorts pointers so the source elements themselves never move
+
+  template <class It, class Project>
+  void build_sorted(It first, It last, bool unique, Project project) {
+    std::vector<Node *> nodes;
+    using category = typename std::iterator_traits<It>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+      nodes.reserve(static_cast<size_type>(std::distance(first, last)));
+    try {
+      for (; first != last; ++first) {
+        auto &&key = project(first);
+        if (unique && !nodes.empty() &&
+            !comp()(key_of(nodes.back()->key_), key_of(key)))
+          continue;
+        nodes.push_back(nullptr);
+        nodes.back() = create_node(std::forward<decltype(key)>(key));
+      }
+    } catch (...) {
+      for (Node *node : nodes)
+        if (node != nullptr) destroy_node(node);
+      throw;
+    }
+    clear();
+    size_type full_levels = 0;
+    while ((size_type{2} << full_levels) - 1 <= nodes.size()) ++full_levels;
+    root_ = link_sorted(nodes.data(), nodes.size(), nullptr, 0, full_levels);
+    size_ = nodes.size();
+  }  // the old contents are released only once every new node exists
+
+  static Node *link_sorted(Node **nodes, size_type n, Node *parent,
+                           size_type depth, size_type red_depth) noexcept {
+    if (n == 0) return nullptr;
+    const size_type mid = n / 2;
+    Node *node = nodes[mid];
+    node->parent_ = parent;
+    node->weight_ = n;
+    node->red_ = depth == red_depth;
+    node->left_ = link_sorted(nodes, mid, node, depth + 1, red_depth);
+    node->right_ =
+        link_sorted(nodes + mid + 1, n - mid - 1, node, depth + 1, red_depth);
+    return node;
+  }  // every level above red_depth is full, the partial last one is red
+
+  void copy_from(const BinaryTree &other) {
+    if (other.root_ == nullptr) return;
+    try {
+      root_ = clone_node(other.root_, nullptr);
+      clone_children(other.root_, root_);
+    } catch (...) {
+      clear();
+      throw;
+    }
+    size_ = other.size_;
+  }  // expects an empty tree, copies shape and colours without comparisons
+
+  Node *clone_node(const Node *source, Node *parent) {
+    Node *copy = create_node(source->key_);
+    copy->weight_ = source->weight_;
+    copy->red_ = source->red_;
+    copy->parent_ = parent;
+    return copy;
+  }
+
+  void clone_children(const Node *source, Node *copy) {
+    if (source->left_ != nullptr) {
+      copy->left_ = clone_node(source->left_, copy);
+      clone_children(source->left_, copy->left_);
+    }
+    if (source->right_ != nullptr) {
+      copy->right_ = clone_node(source->right_, copy);
+      clone_children(source->right_, copy->right_);
+    }
+  }  // each copy is linked before the next allocation, so clear() can free
+     // a partial clone; recursion depth is bounded by the tree height
+
+  template <class K>
+  Node *lower_node(const K &key) const noexcept {
+    const Compare &cmp = comp();
+    Node *result = nullptr;
+    for (Node *current = root_; current != nullptr;) {
+      if (!cmp(key_of(current->key_), key)) {
+        result = current;
+        current = current->left_;
+      } else {
+        current = current->right_;
+      }
+    }
+    return result;
+  }  // first node not less than key
+
+  template <class K>
+  Node *upper_node(const K &key) const noexcept {
+    const Compare &cmp = comp();
+    Node *result = nullptr;
+    for (Node *current = root_; current != nullptr;) {
+      if (cmp(key, key_of(current->key_))) {
+        result = current;
+        current = current->left_;
+      } else {
+        current = current->right_;
+      }
+    }
+    return result;
+  }  // first node greater than key
+
+  template <class K>
+  Node *find_node(const K &key) const noexcept {
+    Node *node = lower_node(key);
+    if (node != nullptr && comp()(key, key_of(node->key_))) node = nullptr;
+    return node;
+  }  // first of the equal keys, so duplicates can be walked forwards
+
+  template <class K>
+  size_type count_equal(const K &key) const noexcept {
+    return count_not_greater(key) - count_less(key);
+  }  // two root-to-leaf descents, independent of how many keys are equal
+
+  template <class K>
+  size_type count_less(const K &key) const noexcept {
+    const Compare &cmp = comp();
+    size_type result = 0;
+    for (Node *current = root_; current != nullptr;) {
+      if (cmp(key_of(current->key_), key)) {
+        result += weight(current->left_) + 1;
+        current = current->right_;
+      } else {
+        current = current->left_;
+      }
+    }
+    return result;
+  }  // number of keys ordered before key
+
+  template <class K>
+  size_type count_not_greater(const K &key) const noexcept {
+    const Compare &cmp = comp();
+    size_type result = 0;
+    for (Node *current = root_; current != nullptr;) {
+      if (cmp(key, key_of(current->key_))) {
+        current = current->left_;
+      } else {
+        result += weight(current->left_) + 1;
+        current = current->right_;
+      }
+    }
+    return result;
+  }  // number of keys not ordered after key
+
+  template <class K1, class K2>
+  size_type range_size(const K1 &lo, const K2 &hi) const noexcept {
+    if (!comp()(lo, hi)) return 0;
+    return count_less(hi) - count_less(lo);
+  }
+
+  Node *select_node(size_type k) const noexcept {
+    Node *current = root_;
+    while (current != nullptr) {
+      const size_type left = weight(current->left_);
+      if (k < left) {
+        current = current->left_;
+      } else if (k == left) {
+        return current;
+      } else {
+        k -= left + 1;
+        current = current->right_;
+      }
+    }
+    return nullptr;
+  }
+
+  static size_type weight(const Node *node) noexcept {
+    return node != nullptr ? node->weight_ : 0;
+  }
+
+  static void add_weight(Node *node, size_type delta) noexcept {
+    for (; node != nullptr; node = node->parent_) node->weight_ += delta;
+  }  // delta wraps around for removals, the sums stay exact
+
+  static void update_weight(Node *node) noexcept {
+    node->weight_ = weight(node->left_) + weight(node->right_) + 1;
+  }
+
+  void replace_child(Node *parent, Node *old_child, Node *new_child) noexcept {
+    if (parent == nullptr)
+      root_ = new_child;
+    else if (parent->left_ == old_child)
+      parent->left_ = new_child;
+    else
+      parent->right_ = new_child;
+  }
+
+  void rotate_left(Node *x) noexcept {
+    Node *y = x->right_;
+    x->right_ = y->left_;
+    if (y->left_ != nullptr) y->left_->parent_ = x;
+    y->parent_ = x->parent_;
+    replace_child(x->parent_, x, y);
+    y->left_ = x;
+    x->parent_ = y;
+    y->weight_ = x->weight_;
+    update_weight(x);
+  }
+
+  void rotate_right(Node *x) noexcept {
+    Node *y = x->left_;
+    x->left_ = y->right_;
+    if (y->right_ != nullptr) y->right_->parent_ = x;
+    y->parent_ = x->parent_;
+    replace_child(x->parent_, x, y);
+    y->right_ = x;
+    x->parent_ = y;
+    y->weight_ = x->weight_;
+    update_weight(x);
+  }
+
+  static bool is_red(const Node *node) noexcept {
+    return node != nullptr && node->red_;
+  }  // null leaves count as black
+
+  void insert_fixup(Node *node) noexcept {
+    while (is_red(node->parent_)) {
+      Node *parent = node->parent_;
+      Node *grand = parent->parent_;
+      if (parent == grand->left_) {
+        Node *uncle = grand->right_;
+        if (is_red(uncle)) {
+          parent->red_ = false;
+          uncle->red_ = false;
+          grand->red_ = true;
+          node = grand;
+        } else {
+          if (node == parent->right_) {
+            node = parent;
+            rotate_left(node);
+            parent = node->parent_;
+          }
+          parent->red_ = false;
+          grand->red_ = true;
+          rotate_right(grand);
+        }
+      } else {
+        Node *uncle = grand->left_;
+        if (is_red(uncle)) {
+          parent->red_ = false;
+          uncle->red_ = false;
+          grand->red_ = true;
+          node = grand;
+        } else {
+          if (node == parent->left_) {
+            node = parent;
+            rotate_right(node);
+            parent = node->parent_;
+          }
+          parent->red_ = false;
+          grand->red_ = true;
+          rotate_left(grand);
+        }
+      }
+    }
+    root_->red_ = false;
+  }  // restores the red-black rules after a red leaf was attached
+
+  void unlink(Node *node) noexcept {
+    Node *child = node->left_ != nullptr ? node->left_ : node->right_;
+    Node *parent = node->parent_;
+    add_weight(parent, size_type(-1));
+    replace_child(parent, node, child);
+    if (child != nullptr) child->parent_ = parent;
+    if (!node->red_) erase_fixup(child, parent);
+  }  // detaches a node with at most one child and rebalances
+
+  void unlink_with_successor(Node *node) noexcept {
+    Node *successor = node->right_;
+    while (successor->left_ != nullptr) successor = successor->left_;
+    const bool removed_red = successor->red_;
+    add_weight(successor->parent_, size_type(-1));
+    Node *child = successor->right_;
+    Node *child_parent = successor;
+    if (successor->parent_ != node) {
+      child_parent = successor->parent_;
+      child_parent->left_ = child;
+      if (child != nullptr) child->parent_ = child_parent;
+      successor->right_ = node->right_;
+      successor->right_->parent_ = successor;
+    }
+    replace_child(node->parent_, node, successor);
+    successor->parent_ = node->parent_;
+    successor->left_ = node->left_;
+    successor->left_->parent_ = successor;
+    successor->red_ = node->red_;
+    successor->weight_ = node->weight_;
+    if (!removed_red) erase_fixup(child, child_parent);
+  }  // moves the successor node into the place of a node with two children
+
+  void erase_fixup(Node *node, Node *parent) noexcept {
+    while (node != root_ && !is_red(node)) {
+      if (node == parent->left_) {
+        Node *sibling = parent->right_;
+        if (is_red(sibling)) {
+          sibling->red_ = false;
+          parent->red_ = true;
+          rotate_left(parent);
+          sibling = parent->right_;
+        }
+        if (!is_red(sibling->left_) && !is_red(sibling->right_)) {
+          sibling->red_ = true;
+          node = parent;
+          parent = node->parent_;
+        } else {
+          if (!is_red(sibling->right_)) {
+            sibling->left_->red_ = false;
+            sibling->red_ = true;
+            rotate_right(sibling);
+            sibling = parent->right_;
+          }
+          sibling->red_ = parent->red_;
+          parent->red_ = false;
+          sibling->right_->red_ = false;
+          rotate_left(parent);
+          node = root_;
+        }
+      } else {
+        Node *sibling = parent->left_;
+        if (is_red(sibling)) {
+          sibling->red_ = false;
+          parent->red_ = true;
+          rotate_right(parent);
+          sibling = parent->left_;
+        }
+        if (!is_red(sibling->left_) && !is_red(sibling->right_)) {
+          sibling->red_ = true;
+          node = parent;
+          parent = node->parent_;
+        } else {
+          if (!is_red(sibling->left_)) {
+            sibling->right_->red_ = false;
+            sibling->red_ = true;
+            rotate_left(sibling);
+            sibling = parent->left_;
+          }
+          sibling->red_ = parent->red_;
+          parent->red_ = false;
+          sibling->left_->red_ = false;
+          rotate_right(parent);
+          node = root_;
+        }
+      }
+    }
+    if (node != nullptr) node->red_ = false;
+  }  // node carries an extra black, parent is tracked since node may be null
 };
 }  // namespace BinaryTree
 
@@ -0,0 +1,318 @@
+#ifndef CPP2_S21_CONTAINERS_1_FLATTREE_H
+#define CPP2_S21_CONTAINERS_1_FLATTREE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../sequential_containers/s21_vector.h"
+#include "BinaryTree.h"
+
+namespace FlatTree {
+
+// Branchless binary searches over n sorted keys. The loop body is a compare
+// and a conditional move, so a lookup costs log2(n) dependent loads and no
+// mispredicted branches.
+template <class Key, class K, class Less>
+size_t lower_index(const Key *first, size_t n, const K &key,
+                   const Less &less) {
+  if (n == 0) return 0;
+  const Key *base = first;
+  while (n > 1) {
+    const size_t half = n / 2;
+    base = less(base[half - 1], key) ? base + half : base;
+    n -= half;
+  }
+  return (base - first) + (less(*base, key) ? 1 : 0);
+}  // index of the first key not less than key
+
+template <class Key, class K, class Less>
+size_t upper_index(const Key *first, size_t n, const K &key,
+                   const Less &less) {
+  if (n == 0) return 0;
+  const Key *base = first;
+  while (n > 1) {
+    const size_t half = n / 2;
+    base = less(key, base[half - 1]) ? base : base + half;
+    n -= half;
+  }
+  return (base - first) + (less(key, *base) ? 0 : 1);
+}  // index of the first key greater than key
+
+// Ordered storage in one sorted s21::Vector. Lookups are binary searches over
+// contiguous keys and iteration is a linear scan, with no per-key pointers.
+// A single insert or erase shifts the tail, so it is O(n); ranges are
+// appended, sorted and merged in one pass instead.
+//
+// Any insert or erase invalidates iterators at or after the changed position,
+// and all of them if the storage grows.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class FlatTree : private BinaryTree::CompareHolder<Compare> {
+ private:
+  using compare_holder = BinaryTree::CompareHolder<Compare>;
+  using compare_holder::comp;
+  using storage_type = s21::Vector<Key, Allocator>;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using key_type = Key;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using iterator = typename storage_type::const_iterator;
+  using const_iterator = iterator;
+
+  FlatTree() : FlatTree(Compare(), Allocator()) {}
+  explicit FlatTree(const allocator_type &alloc) : FlatTree(Compare(), alloc) {}
+  explicit FlatTree(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : compare_holder(comp), keys_(alloc) {}
+  FlatTree(const FlatTree &other)
+      : compare_holder(other.comp()), keys_(other.keys_) {}
+  FlatTree(FlatTree &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Compare>)
+      : compare_holder(other.comp()), keys_(std::move(other.keys_)) {}
+
+  FlatTree &operator=(const FlatTree &other) & {
+    if (this == &other) return *this;
+    storage_type keys(
+        other.keys_,
+        alloc_traits::propagate_on_container_copy_assignment::value
+            ? other.keys_.Get_Allocator()
+            : keys_.Get_Allocator());
+    comp() = other.comp();
+    keys_ = std::move(keys);
+    return *this;
+  }  // the copy is made first, so a throwing copy leaves *this untouched
+
+  FlatTree &operator=(FlatTree &&other) &noexcept(
+      std::is_nothrow_move_assignable_v<storage_type> &&
+      std::is_nothrow_copy_assignable_v<Compare>) {
+    if (this == &other) return *this;
+    comp() = other.comp();
+    keys_ = std::move(other.keys_);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return keys_.Get_Allocator();
+  }
+
+  key_compare key_comp() const { return comp(); }
+
+  const_iterator begin() const noexcept { return keys_.Cbegin(); }
+  const_iterator end() const noexcept { return keys_.Cend(); }
+
+  [[nodiscard]] bool empty() const noexcept { return keys_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return keys_.Size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return keys_.Max_Size();
+  }
+  size_type capacity() const noexcept { return keys_.Capacity(); }
+  void reserve(size_type n) { keys_.Reserve(n); }
+  void shrink_to_fit() { keys_.Shrink_To_Fit(); }
+
+  void clear() noexcept { keys_.Clear(); }
+
+  void swap(FlatTree &other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(comp(), other.comp());
+    keys_.Swap(other.keys_);
+  }  // without propagation the allocators must compare equal
+
+  template <class V>
+  std::pair<iterator, bool> insert_unique(V &&value) {
+    const size_type i = lower_index(value);
+    if (i != size() && !comp()(value, keys_[i])) return {begin() + i, false};
+    return {keys_.Emplace(keys_.Cbegin() + i, std::forward<V>(value)), true};
+  }
+
+  template <class V>
+  iterator insert_equal(V &&value) {
+    const size_type i = upper_index(value);
+    return keys_.Emplace(keys_.Cbegin() + i, std::forward<V>(value));
+  }  // equal keys keep their insertion order
+
+  // Appends [first, last), sorts the new run and merges it into place, so a
+  // batch of k keys costs O(k log k + n) rather than k shifts of the tail.
+  // Both the sort and the merge are stable: when unique is set the key that
+  // was already here wins, then the first of equal keys in the batch. If a
+  // comparison or a move throws after the batch is appended, the container
+  // is left empty.
+  template <class InputIt>
+  void insert_range(InputIt first, InputIt last, bool unique) {
+    const size_type old_size = size();
+    try {
+      for (; first != last; ++first) keys_.Emplace_Back(*first);
+    } catch (...) {
+      erase_tail(old_size);
+      throw;
+    }
+    try {
+      merge_tail(old_size, unique);
+    } catch (...) {
+      clear();
+      throw;
+    }
+  }
+
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last, bool unique) {
+    clear();
+    insert_range(first, last, unique);
+  }  // O(n) for sorted input, anything else is sorted first
+
+  void merge(FlatTree &other) {
+    if (this == &other) return;
+    const size_type old_size = size();
+    keys_.Reserve(old_size + other.size());
+    size_type kept = 0;
+    for (size_type i = 0; i < other.size(); ++i) {
+      const Key &key = other.keys_[i];
+      const size_type at =
+          ::FlatTree::lower_index(data(), old_size, key, comp());
+      if (at != old_size && !comp()(key, keys_[at])) {
+        if (kept != i) other.keys_[kept] = std::move(other.keys_[i]);
+        ++kept;
+      } else {
+        keys_.Push_Back(std::move(other.keys_[i]));
+      }
+    }
+    other.erase_tail(kept);
+    merge_tail(old_size, false);
+  }  // keys that are already here stay in other, in their order
+
+  void merge_with_repetitions(FlatTree &other) {
+    if (this == &other) return;
+    const size_type old_size = size();
+    keys_.Reserve(old_size + other.size());
+    for (size_type i = 0; i < other.size(); ++i)
+      keys_.Push_Back(std::move(other.keys_[i]));
+    other.clear();
+    merge_tail(old_size, false);
+  }  // equal keys from other are placed after the ones already here
+
+  iterator erase(const_iterator pos) {
+    const size_type i = pos - begin();
+    keys_.Erase(keys_.Begin() + i);
+    return begin() + i;
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_type from = first - begin();
+    const size_type count = last - first;
+    if (count == 0) return begin() + from;
+    std::move(keys_.Begin() + from + count, keys_.End(),
+              keys_.Begin() + from);
+    erase_tail(size() - count);
+    return begin() + from;
+  }  // shifts the tail once for the whole range
+
+  const Key &at(const key_type &key) const {
+    auto it = find(key);
+    if (it != end()) return *it;
+    throw std::out_of_range("Key not found in FlatTree");
+  }
+
+  // Lookups take a key_type, or with a transparent Compare anything it can
+  // compare keys against.
+  const_iterator find(const key_type &key) const noexcept {
+    return find_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return find_equal(key);
+  }
+
+  bool contains(const key_type &key) const noexcept {
+    return find_equal(key) != end();
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return find_equal(key) != end();
+  }
+
+  size_type count(const key_type &key) const noexcept {
+    return upper_index(key) - lower_index(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) const noexcept {
+    return upper_index(key) - lower_index(key);
+  }
+
+  const_iterator lower_bound(const key_type &key) const noexcept {
+    return begin() + lower_index(key);
+  }
+  const_iterator upper_bound(const key_type &key) const noexcept {
+    return begin() + upper_index(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const key_type &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+
+  // Order statistics are plain index arithmetic on the sorted storage.
+  const_iterator nth_element(size_type k) const noexcept {
+    return k < size() ? begin() + k : end();
+  }
+  size_type rank(const key_type &key) const noexcept {
+    return lower_index(key);
+  }
+  size_type count_range(const key_type &lo, const key_type &hi) const noexcept {
+    if (!comp()(lo, hi)) return 0;
+    return lower_index(hi) - lower_index(lo);
+  }  // keys in [lo, hi)
+
+ private:
+  storage_type keys_;
+
+  const Key *data() const noexcept {
+    return const_cast<storage_type &>(keys_).Data();
+  }
+
+  template <class K>
+  size_type lower_index(const K &key) const noexcept {
+    return ::FlatTree::lower_index(data(), size(), key, comp());
+  }
+
+  template <class K>
+  size_type upper_index(const K &key) const noexcept {
+    return ::FlatTree::upper_index(data(), size(), key, comp());
+  }
+
+  template <class K>
+  const_iterator find_equal(const K &key) const noexcept {
+    const size_type i = lower_index(key);
+    if (i == size() || comp()(key, keys_[i])) return end();
+    return begin() + i;
+  }
+
+  void erase_tail(size_type new_size) noexcept {
+    while (size() > new_size) keys_.Pop_Back();
+  }
+
+  void merge_tail(size_type old_size, bool unique) {
+    auto less = [this](const Key &a, const Key &b) { return comp()(a, b); };
+    const auto first = keys_.Begin();
+    const auto middle = first + old_size;
+    const auto last = keys_.End();
+    if (!std::is_sorted(middle, last, less))
+      std::stable_sort(middle, last, less);
+    if (old_size != 0 && middle != last && less(*middle, middle[-1]))
+      std::inplace_merge(first, middle, last, less);
+    if (!unique) return;
+    auto equal = [this](const Key &a, const Key &b) {
+      return !comp()(a, b);
+    };  // neighbours are sorted, so not-less means equivalent
+    erase_tail(std::unique(first, last, equal) - first);
+  }  // sorts keys past old_size and merges them with the sorted prefix
+};
+}  // namespace FlatTree
+
+#endif  // CPP2_S21_CONTAINERS_1_FLATTREE_H
@@ -0,0 +1,591 @@
+#ifndef CPP2_S21_CONTAINERS_1_HASHTABLE_H
+#define CPP2_S21_CONTAINERS_1_HASHTABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "BinaryTree.h"
+
+namespace HashTable {
+
+// Open addressing with Robin Hood probing. Every slot has a metadata byte
+// holding its value's probe distance plus one (0 marks a free slot), and
+// values are kept ordered by home bucket within a run, so a lookup stops as
+// soon as it meets a slot closer to home than the probe. Erase shifts the
+// rest of the run back instead of leaving tombstones.
+//
+// The home bucket is picked from the high bits of hash * 2^64 / phi, which
+// spreads identity hashes such as std::hash<int> across a power-of-two table.
+// Probes never wrap: the table has up to kMaxProbe overflow slots past the
+// last bucket, the very last slot is kept free so every probe stops in
+// bounds, and running out of either grows the table. A hash so poor that a
+// run overflows even in a mostly empty table makes insert throw
+// std::overflow_error instead, keeping the values already there.
+//
+// Values move when the table grows, and insert and erase shift values within
+// a run, so any insert or erase invalidates all iterators.
+template <class T, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>,
+          class Allocator = std::allocator<T>,
+          class KeyOfValue = BinaryTree::Identity>
+class HashTable {
+ private:
+  using value_traits = std::allocator_traits<Allocator>;
+  using meta_allocator =
+      typename value_traits::template rebind_alloc<std::uint8_t>;
+  using meta_traits = std::allocator_traits<meta_allocator>;
+
+  static constexpr std::uint8_t kEmpty = 0;
+  static constexpr std::uint8_t kSentinel = 0xFF;
+  static constexpr size_t kMaxProbe = 128;
+  static constexpr size_t kMinBuckets = 8;
+
+  static_assert(BinaryTree::Relocation<T>::kNothrow,
+                "Robin Hood shifts move values along a run and cannot be "
+                "undone if a move throws");
+
+  struct Storage {
+    std::uint8_t *meta_ = nullptr;  // total_ + 1 bytes, the last a sentinel
+    T *slots_ = nullptr;
+    size_t buckets_ = 0;  // home positions, a power of two
+    size_t total_ = 0;    // buckets_ plus the overflow slots
+    unsigned shift_ = 0;
+
+    size_t home(size_t hash) const noexcept {
+      return static_cast<size_t>(
+          (static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL) >>
+          shift_);
+    }
+  };
+
+ public:
+  using key_type = std::remove_cv_t<std::remove_reference_t<decltype(
+      KeyOfValue{}(std::declval<const T &>()))>>;
+  using value_type = T;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  template <class Value>
+  struct basic_iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_const_t<Value>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    const std::uint8_t *meta_;
+    Value *slot_;
+
+    basic_iterator() : meta_(nullptr), slot_(nullptr) {}
+    basic_iterator(const std::uint8_t *meta, Value *slot)
+        : meta_(meta), slot_(slot) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Value> &&
+                               !std::is_same_v<Other, Value>>>
+    basic_iterator(const basic_iterator<Other> &other)  // NOLINT
+        : meta_(other.meta_), slot_(other.slot_) {}
+
+    basic_iterator &operator++() &noexcept {
+      do {
+        ++meta_;
+        ++slot_;
+      } while (*meta_ == kEmpty);
+      return *this;
+    }  // the sentinel byte past the last slot stops the scan
+
+    basic_iterator operator++(int) &noexcept {
+      basic_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    friend bool operator==(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return a.meta_ == b.meta_;
+    }
+    friend bool operator!=(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return a.meta_ != b.meta_;
+    }
+
+    Value &operator*() const { return *slot_; }
+    Value *operator->() const { return slot_; }
+  };
+
+  using iterator = basic_iterator<T>;
+  using const_iterator = basic_iterator<const T>;
+
+  HashTable() : HashTable(0) {}
+  explicit HashTable(const allocator_type &alloc)
+      : HashTable(0, Hash(), KeyEqual(), alloc) {}
+  explicit HashTable(size_type buckets, const Hash &hash = Hash(),
+                     const KeyEqual &equal = KeyEqual(),
+                     const allocator_type &alloc = allocator_type())
+      : hash_(hash), equal_(equal), alloc_(alloc) {
+    if (buckets != 0) rehash(buckets);
+  }
+  HashTable(const HashTable &other)
+      : HashTable(other, value_traits::select_on_container_copy_construction(
+                             other.alloc_)) {}
+  HashTable(const HashTable &other, const allocator_type &alloc)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        alloc_(alloc),
+        max_load_factor_(other.max_load_factor_) {
+    if (other.storage_.meta_ == nullptr) return;
+    Storage copy = allocate_storage(other.storage_.buckets_);
+    size_type i = 0;
+    try {
+      for (; i < copy.total_; ++i) {
+        if (other.storage_.meta_[i] != kEmpty)
+          construct_value(copy.slots_ + i, other.storage_.slots_[i]);
+      }
+    } catch (...) {
+      while (i-- > 0)
+        if (other.storage_.meta_[i] != kEmpty) destroy_value(copy.slots_ + i);
+      release_storage(copy);
+      throw;
+    }
+    std::memcpy(copy.meta_, other.storage_.meta_, copy.total_);
+    adopt(copy);
+    size_ = other.size_;
+  }  // same buckets and positions, so nothing is hashed again
+  HashTable(HashTable &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Hash> &&
+      std::is_nothrow_copy_constructible_v<KeyEqual>)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        alloc_(std::move(other.alloc_)),
+        storage_(other.storage_),
+        size_(other.size_),
+        growth_limit_(other.growth_limit_),
+        max_load_factor_(other.max_load_factor_) {
+    other.forget();
+  }
+
+  ~HashTable() {
+    clear();
+    release_storage(storage_);
+  }
+
+  HashTable &operator=(const HashTable &other) & {
+    if (this == &other) return *this;
+    HashTable copy(
+        other, value_traits::propagate_on_container_copy_assignment::value
+                   ? other.alloc_
+                   : alloc_);
+    take(copy);
+    return *this;
+  }  // the copy is made first, so a throwing copy leaves *this untouched
+
+  HashTable &operator=(HashTable &&other) &noexcept(
+      (value_traits::propagate_on_container_move_assignment::value ||
+       value_traits::is_always_equal::value) &&
+      std::is_nothrow_copy_assignable_v<Hash> &&
+      std::is_nothrow_copy_assignable_v<KeyEqual>) {
+    if (this == &other) return *this;
+    if constexpr (!value_traits::propagate_on_container_move_assignment::
+                      value) {
+      if (alloc_ != other.alloc_) {
+        clear();
+        hash_ = other.hash_;
+        equal_ = other.equal_;
+        max_load_factor_ = other.max_load_factor_;
+        reserve(other.size_);
+        for (auto &value : other) insert_unchecked(std::move(value));
+        other.clear();
+        return *this;
+      }
+    }
+    take(other);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  iterator begin() noexcept {
+    if (storage_.meta_ == nullptr) return end();
+    iterator it(storage_.meta_, storage_.slots_);
+    if (*it.meta_ == kEmpty) ++it;
+    return it;
+  }
+  const_iterator begin() const noexcept {
+    return const_cast<HashTable *>(this)->begin();
+  }
+  iterator end() noexcept {
+    return iterator(storage_.meta_ + storage_.total_,
+                    storage_.slots_ + storage_.total_);
+  }
+  const_iterator end() const noexcept {
+    return const_cast<HashTable *>(this)->end();
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min<size_type>(SIZE_MAX / (sizeof(T) + 1) / 2,
+                               value_traits::max_size(alloc_));
+  }
+
+  size_type bucket_count() const noexcept { return storage_.buckets_; }
+  float load_factor() const noexcept {
+    return storage_.buckets_ == 0
+               ? 0.0f
+               : static_cast<float>(size_) /
+                     static_cast<float>(storage_.buckets_);
+  }
+  float max_load_factor() const noexcept { return max_load_factor_; }
+  void max_load_factor(float ml) {
+    if (!(ml > 0.0f && ml <= 1.0f))
+      throw std::invalid_argument("max_load_factor must be in (0, 1]");
+    max_load_factor_ = ml;
+    growth_limit_ = limit_for(storage_.buckets_);
+    if (size_ > growth_limit_) rehash(0);
+  }  // the overflow slots let a table fill every bucket, but probes lengthen
+
+  // Sets the bucket count to at least n, and to no fewer than the current
+  // size needs under max_load_factor. The count is rounded up to a power of
+  // two, and may shrink.
+  void rehash(size_type n) {
+    const auto needed = static_cast<size_type>(
+        std::ceil(static_cast<double>(size_) / max_load_factor_));
+    size_type buckets = kMinBuckets;
+    while (buckets < n || buckets < needed) buckets *= 2;
+    if (buckets == storage_.buckets_) return;
+    resize(buckets);
+  }
+  void reserve(size_type n) {
+    rehash(static_cast<size_type>(
+        std::ceil(static_cast<double>(n) / max_load_factor_)));
+  }  // makes room for n values without growing again
+
+  void clear() noexcept {
+    if (size_ != 0) {
+      for (size_type i = 0; i < storage_.total_; ++i) {
+        if (storage_.meta_[i] != kEmpty) destroy_value(storage_.slots_ + i);
+      }
+      std::memset(storage_.meta_, kEmpty, storage_.total_);
+    }
+    size_ = 0;
+  }  // keeps the buckets
+
+  void swap(HashTable &other) noexcept(std::is_nothrow_swappable_v<Hash> &&
+                                       std::is_nothrow_swappable_v<KeyEqual>) {
+    using std::swap;
+    swap(hash_, other.hash_);
+    swap(equal_, other.equal_);
+    if constexpr (value_traits::propagate_on_container_swap::value)
+      swap(alloc_, other.alloc_);
+    swap(storage_, other.storage_);
+    swap(size_, other.size_);
+    swap(growth_limit_, other.growth_limit_);
+    swap(max_load_factor_, other.max_load_factor_);
+  }  // without propagation the allocators must compare equal
+
+  // Inserts a value built from args unless one with an equal key is already
+  // here; key must be the key those args produce. The value is built straight
+  // in its slot when that slot is free, otherwise it is built first so args
+  // may refer into the table while values are being moved around.
+  template <class K, class... Args>
+  std::pair<iterator, bool> emplace_unique(const K &key, Args &&...args) {
+    const size_type hash = hash_(key);
+    size_type pos = 0;
+    size_type dist = 1;
+    if (storage_.meta_ != nullptr) {
+      pos = storage_.home(hash);
+      for (; storage_.meta_[pos] >= dist; ++pos, ++dist) {
+        if (storage_.meta_[pos] == dist &&
+            equal_(key_of(storage_.slots_[pos]), key))
+          return {make_iterator(pos), false};
+      }
+      if (storage_.meta_[pos] == kEmpty && pos + 1 < storage_.total_ &&
+          dist <= kMaxProbe && size_ < growth_limit_) {
+        construct_value(storage_.slots_ + pos, std::forward<Args>(args)...);
+        storage_.meta_[pos] = static_cast<std::uint8_t>(dist);
+        ++size_;
+        return {make_iterator(pos), true};
+      }
+    }
+    return {insert_built(hash, std::forward<Args>(args)...), true};
+  }
+
+  template <class... Args>
+  iterator insert_unchecked(Args &&...args) {
+    return insert_built(npos, std::forward<Args>(args)...);
+  }  // no lookup first, for values known to be missing
+
+  iterator erase(const_iterator pos) {
+    const size_type i = pos.meta_ - storage_.meta_;
+    destroy_value(storage_.slots_ + i);
+    close_gap(i);
+    --size_;
+    iterator next = make_iterator(i);
+    if (*next.meta_ == kEmpty) ++next;
+    return next;
+  }  // the next value may have shifted into pos, so it is returned as is
+
+  template <class K>
+  size_type erase_key(const K &key) {
+    const size_type i = find_index(key);
+    if (i == npos) return 0;
+    destroy_value(storage_.slots_ + i);
+    close_gap(i);
+    --size_;
+    return 1;
+  }
+
+  void merge(HashTable &other) {
+    if (this == &other) return;
+    for (auto it = other.begin(); it != other.end();) {
+      if (emplace_unique(key_of(*it), std::move(*it)).second)
+        it = other.erase(it);
+      else
+        ++it;
+    }
+  }  // values whose keys are already here stay in other
+
+  T &at(const key_type &key) & {
+    auto it = find(key);
+    if (it != end()) return *it;
+    throw std::out_of_range("Key not found in HashTable");
+  }
+  const T &at(const key_type &key) const & {
+    auto it = find(key);
+    if (it != end()) return *it;
+    throw std::out_of_range("Key not found in HashTable");
+  }
+
+  // Lookups take a key_type, or with a transparent Hash and KeyEqual
+  // anything they accept.
+  template <class K>
+  iterator find(const K &key) noexcept {
+    const size_type i = find_index(key);
+    return i == npos ? end() : make_iterator(i);
+  }
+  template <class K>
+  const_iterator find(const K &key) const noexcept {
+    return const_cast<HashTable *>(this)->find(key);
+  }
+  template <class K>
+  bool contains(const K &key) const noexcept {
+    return find_index(key) != npos;
+  }
+
+ private:
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  Hash hash_;
+  KeyEqual equal_;
+  Allocator alloc_;
+  Storage storage_;
+  size_type size_ = 0;
+  size_type growth_limit_ = 0;
+  float max_load_factor_ = 0.875f;
+
+  static const key_type &key_of(const T &value) noexcept {
+    return KeyOfValue{}(value);
+  }
+
+  iterator make_iterator(size_type i) noexcept {
+    return iterator(storage_.meta_ + i, storage_.slots_ + i);
+  }
+
+  size_type limit_for(size_type buckets) const noexcept {
+    return static_cast<size_type>(static_cast<double>(buckets) *
+                                  max_load_factor_);
+  }
+
+  template <class K>
+  size_type find_index(const K &key) const noexcept {
+    if (size_ == 0) return npos;
+    size_type pos = storage_.home(hash_(key));
+    for (size_type dist = 1; storage_.meta_[pos] >= dist; ++pos, ++dist) {
+      if (storage_.meta_[pos] == dist &&
+          equal_(key_of(storage_.slots_[pos]), key))
+        return pos;
+    }
+    return npos;
+  }  // a run is ordered by home bucket, so a closer-to-home slot ends it
+
+  template <class... Args>
+  void construct_value(T *where, Args &&...args) {
+    value_traits::construct(alloc_, where, std::forward<Args>(args)...);
+  }
+
+  void destroy_value(T *value) noexcept {
+    value_traits::destroy(alloc_, value);
+  }
+
+  void relocate(T *to, T &from) noexcept {
+    BinaryTree::Relocation<T>::relocate(alloc_, to, from);
+  }
+
+  // Builds the value in a local buffer, grows the table if it is due, then
+  // moves the value into a slot. hash is npos when it has to be computed.
+  template <class... Args>
+  iterator insert_built(size_type hash, Args &&...args) {
+    alignas(T) unsigned char buffer[sizeof(T)];
+    T *value = reinterpret_cast<T *>(buffer);
+    construct_value(value, std::forward<Args>(args)...);
+    try {
+      if (hash == npos) hash = hash_(key_of(*value));
+      if (size_ >= growth_limit_) rehash(storage_.buckets_ * 2);
+      size_type pos = 0;
+      while (!make_room(storage_, hash, pos)) {
+        if (sparse(storage_.buckets_)) throw_overflow();
+        resize(storage_.buckets_ * 2);
+      }
+      relocate(storage_.slots_ + pos, *value);
+      ++size_;
+      return make_iterator(pos);
+    } catch (...) {
+      destroy_value(value);
+      throw;
+    }
+  }
+
+  // Opens a slot for a value with this hash: finds where its run wants it and
+  // shifts the rest of the run one slot on. Returns false, changing nothing,
+  // if that needs a probe longer than kMaxProbe or the table's last slot.
+  bool make_room(Storage &s, size_type hash, size_type &pos) {
+    pos = s.home(hash);
+    size_type dist = 1;
+    while (s.meta_[pos] >= dist) {
+      ++pos;
+      ++dist;
+    }
+    if (dist > kMaxProbe) return false;
+    size_type free = pos;
+    for (; s.meta_[free] != kEmpty; ++free) {
+      if (s.meta_[free] == kMaxProbe) return false;
+    }
+    if (free + 1 >= s.total_) return false;
+    for (size_type i = free; i > pos; --i) {
+      relocate(s.slots_ + i, s.slots_[i - 1]);
+      s.meta_[i] = static_cast<std::uint8_t>(s.meta_[i - 1] + 1);
+    }
+    s.meta_[pos] = static_cast<std::uint8_t>(dist);
+    return true;
+  }
+
+  void close_gap(size_type i) noexcept {
+    size_type next = i + 1;
+    for (; storage_.meta_[next] > 1; ++i, ++next) {
+      relocate(storage_.slots_ + i, storage_.slots_[next]);
+      storage_.meta_[i] = static_cast<std::uint8_t>(storage_.meta_[next] - 1);
+    }
+    storage_.meta_[i] = kEmpty;
+  }  // backward shift: the run after i moves one slot closer to home
+
+  Storage allocate_storage(size_type buckets) {
+    Storage s;
+    s.buckets_ = std::max(buckets, kMinBuckets);
+    s.total_ = s.buckets_ + std::min(s.buckets_, kMaxProbe);
+    s.shift_ = 64;
+    for (size_type b = s.buckets_; b > 1; b /= 2) --s.shift_;
+    meta_allocator meta_alloc(alloc_);
+    s.meta_ = meta_traits::allocate(meta_alloc, s.total_ + 1);
+    try {
+      s.slots_ = value_traits::allocate(alloc_, s.total_);
+    } catch (...) {
+      meta_traits::deallocate(meta_alloc, s.meta_, s.total_ + 1);
+      throw;
+    }
+    std::memset(s.meta_, kEmpty, s.total_);
+    s.meta_[s.total_] = kSentinel;
+    return s;
+  }
+
+  void release_storage(Storage &s) noexcept {
+    if (s.meta_ == nullptr) return;
+    meta_allocator meta_alloc(alloc_);
+    meta_traits::deallocate(meta_alloc, s.meta_, s.total_ + 1);
+    value_traits::deallocate(alloc_, s.slots_, s.total_);
+    s = Storage();
+  }
+
+  // Moves the values of from into to, clearing their metadata in from.
+  // Returns false if a run in to would overflow, with some values moved.
+  bool transfer(Storage &from, Storage &to) {
+    for (size_type i = 0; i < from.total_; ++i) {
+      if (from.meta_[i] == kEmpty) continue;
+      T &value = from.slots_[i];
+      size_type pos = 0;
+      if (!make_room(to, hash_(key_of(value)), pos)) return false;
+      relocate(to.slots_ + pos, value);
+      from.meta_[i] = kEmpty;
+    }
+    return true;
+  }
+
+  // Moves every value into a table of at least the given bucket count,
+  // doubling it while some run would overflow. A failed attempt is undone
+  // by moving the values back: a Robin Hood layout depends only on the set
+  // of values, so they fit where they were.
+  void resize(size_type buckets) {
+    for (;; buckets *= 2) {
+      Storage fresh = allocate_storage(buckets);
+      if (transfer(storage_, fresh)) {
+        release_storage(storage_);
+        adopt(fresh);
+        return;
+      }
+      transfer(fresh, storage_);
+      release_storage(fresh);
+      if (sparse(buckets)) throw_overflow();
+    }
+  }
+
+  bool sparse(size_type buckets) const noexcept {
+    return buckets / 4 > size_;
+  }  // an overflowing run in a table this empty means the hash collides
+
+  [[noreturn]] static void throw_overflow() {
+    throw std::overflow_error("HashTable probe limit exceeded by a bad hash");
+  }
+
+  void adopt(Storage &s) noexcept {
+    storage_ = s;
+    growth_limit_ = limit_for(storage_.buckets_);
+  }
+
+  void forget() noexcept {
+    storage_ = Storage();
+    size_ = 0;
+    growth_limit_ = 0;
+  }
+
+  void take(HashTable &other) noexcept {
+    clear();
+    release_storage(storage_);
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    if constexpr (value_traits::propagate_on_container_move_assignment::
+                      value ||
+                  value_traits::propagate_on_container_copy_assignment::
+                      value)
+      alloc_ = other.alloc_;
+    storage_ = other.storage_;
+    size_ = other.size_;
+    growth_limit_ = other.growth_limit_;
+    max_load_factor_ = other.max_load_factor_;
+    other.forget();
+  }  // steals other's storage, the allocators must be interchangeable
+};
+}  // namespace HashTable
+
+#endif  // CPP2_S21_CONTAINERS_1_HASHTABLE_H
@@ -0,0 +1,560 @@
+#ifndef CPP2_S21_CONTAINERS_1_SWISSTABLE_H
+#define CPP2_S21_CONTAINERS_1_SWISSTABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// Define S21_HASH_SCALAR_GROUPS to probe with the portable group even where
+// SSE2 or AVX2 is available.
+#if !defined(S21_HASH_SCALAR_GROUPS) && defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace SwissTable {
+// Control byte of a slot: a full slot holds the low seven bits of its
+// value's hash, the other states have the sign bit set.
+using ctrl_t = std::int8_t;
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+constexpr ctrl_t kSentinel = -1;
+
+// Bit i set for every control byte i of a group that matched.
+class BitMask {
+ public:
+  explicit BitMask(std::uint32_t bits) noexcept : bits_(bits) {}
+
+  explicit operator bool() const noexcept { return bits_ != 0; }
+  unsigned lowest() const noexcept {
+    return static_cast<unsigned>(__builtin_ctz(bits_));
+  }
+  void clear_lowest() noexcept { bits_ &= bits_ - 1; }
+
+ private:
+  std::uint32_t bits_;
+};
+
+// A group of control bytes matched one byte at a time, for targets without
+// SSE2 or for builds with S21_HASH_SCALAR_GROUPS.
+struct ScalarGroup {
+  static constexpr std::size_t kWidth = 16;
+
+  explicit ScalarGroup(const ctrl_t *ctrl) noexcept {
+    std::memcpy(ctrl_, ctrl, kWidth);
+  }
+  BitMask match(ctrl_t h2) const noexcept {
+    std::uint32_t bits = 0;
+    for (std::size_t i = 0; i < kWidth; ++i)
+      bits |= static_cast<std::uint32_t>(ctrl_[i] == h2) << i;
+    return BitMask(bits);
+  }
+  BitMask match_empty() const noexcept { return match(kEmpty); }
+  BitMask match_empty_or_deleted() const noexcept {
+    std::uint32_t bits = 0;
+    for (std::size_t i = 0; i < kWidth; ++i)
+      bits |= static_cast<std::uint32_t>(ctrl_[i] < kSentinel) << i;
+    return BitMask(bits);
+  }
+
+  ctrl_t ctrl_[kWidth];
+};
+
+#if !defined(S21_HASH_SCALAR_GROUPS) && defined(__SSE2__)
+// Sixteen control bytes compared by one SSE2 instruction each.
+struct Sse2Group {
+  static constexpr std::size_t kWidth = 16;
+
+  explicit Sse2Group(const ctrl_t *ctrl) noexcept
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+  BitMask match(ctrl_t h2) const noexcept {
+    return BitMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_))));
+  }
+  BitMask match_empty() const noexcept { return match(kEmpty); }
+  BitMask match_empty_or_deleted() const noexcept {
+    return BitMask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_))));
+  }
+
+  __m128i ctrl_;
+};
+#endif
+
+#if !defined(S21_HASH_SCALAR_GROUPS) && defined(__AVX2__)
+// Thirty-two control bytes per AVX2 compare, so a probe covers two SSE2
+// groups at once.
+struct Avx2Group {
+  static constexpr std::size_t kWidth = 32;
+
+  explicit Avx2Group(const ctrl_t *ctrl) noexcept
+      : ctrl_(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ctrl))) {}
+  BitMask match(ctrl_t h2) const noexcept {
+    return BitMask(static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_set1_epi8(h2), ctrl_))));
+  }
+  BitMask match_empty() const noexcept { return match(kEmpty); }
+  BitMask match_empty_or_deleted() const noexcept {
+    return BitMask(static_cast<std::uint32_t>(_mm256_movemask_epi8(
+        _mm256_cmpgt_epi8(_mm256_set1_epi8(kSentinel), ctrl_))));
+  }
+
+  __m256i ctrl_;
+};
+using Group = Avx2Group;
+#elif !defined(S21_HASH_SCALAR_GROUPS) && defined(__SSE2__)
+using Group = Sse2Group;
+#else
+using Group = ScalarGroup;
+#endif
+
+// Open addressing over groups of Group::kWidth slots with one control byte
+// each. The hash is split in two: the high bits pick the first group to
+// probe and the low seven are stored in the control byte, so a probe
+// compares a whole group's bytes at once and touches a value only on a
+// seven-bit match. Groups are probed quadratically and a group with an
+// empty slot ends the probe.
+//
+// Erase leaves a deleted marker unless the slot's group has an empty slot,
+// and markers are cleared by the next rebuild. Values never move on insert
+// or erase, so only a rebuild, which happens on an insert that finds the
+// table full, invalidates iterators to other values.
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class SwissTable {
+ private:
+  using value_traits = std::allocator_traits<Allocator>;
+  using ctrl_allocator = typename value_traits::template rebind_alloc<ctrl_t>;
+  using ctrl_traits = std::allocator_traits<ctrl_allocator>;
+
+  static constexpr std::size_t kWidth = Group::kWidth;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  struct const_iterator {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Key;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Key *;
+    using reference = const Key &;
+
+    const ctrl_t *ctrl_;
+    const Key *slot_;
+
+    const_iterator() : ctrl_(nullptr), slot_(nullptr) {}
+    const_iterator(const ctrl_t *ctrl, const Key *slot)
+        : ctrl_(ctrl), slot_(slot) {}
+
+    const_iterator &operator++() &noexcept {
+      do {
+        ++ctrl_;
+        ++slot_;
+      } while (*ctrl_ < kSentinel);
+      return *this;
+    }  // skips empty and deleted slots, the sentinel stops the scan
+
+    const_iterator operator++(int) &noexcept {
+      const_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+
+    friend bool operator==(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.ctrl_ == b.ctrl_;
+    }
+    friend bool operator!=(const const_iterator &a,
+                           const const_iterator &b) noexcept {
+      return a.ctrl_ != b.ctrl_;
+    }
+
+    const Key &operator*() const { return *slot_; }
+    const Key *operator->() const { return slot_; }
+  };
+  using iterator = const_iterator;
+
+  SwissTable() : SwissTable(0) {}
+  explicit SwissTable(const allocator_type &alloc)
+      : SwissTable(0, Hash(), KeyEqual(), alloc) {}
+  explicit SwissTable(size_type buckets, const Hash &hash = Hash(),
+                      const KeyEqual &equal = KeyEqual(),
+                      const allocator_type &alloc = allocator_type())
+      : hash_(hash), equal_(equal), alloc_(alloc) {
+    if (buckets != 0) rehash(buckets);
+  }
+  SwissTable(const SwissTable &other)
+      : SwissTable(other, value_traits::select_on_container_copy_construction(
+                              other.alloc_)) {}
+  SwissTable(const SwissTable &other, const allocator_type &alloc)
+      : hash_(other.hash_), equal_(other.equal_), alloc_(alloc) {
+    if (other.capacity_ == 0) return;
+    allocate(other.capacity_);
+    size_type i = 0;
+    try {
+      for (; i < capacity_; ++i) {
+        if (other.ctrl_[i] >= 0) construct_value(slots_ + i, other.slots_[i]);
+      }
+    } catch (...) {
+      while (i-- > 0)
+        if (other.ctrl_[i] >= 0) destroy_value(slots_ + i);
+      release();
+      throw;
+    }
+    std::memcpy(ctrl_, other.ctrl_, capacity_);
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+  }  // same slots and markers, so nothing is hashed again
+  SwissTable(SwissTable &&other) noexcept(
+      std::is_nothrow_copy_constructible_v<Hash> &&
+      std::is_nothrow_copy_constructible_v<KeyEqual>)
+      : hash_(other.hash_),
+        equal_(other.equal_),
+        alloc_(std::move(other.alloc_)),
+        ctrl_(other.ctrl_),
+        slots_(other.slots_),
+        capacity_(other.capacity_),
+        size_(other.size_),
+        growth_left_(other.growth_left_) {
+    other.forget();
+  }
+
+  ~SwissTable() {
+    destroy_values();
+    release();
+  }
+
+  SwissTable &operator=(const SwissTable &other) & {
+    if (this == &other) return *this;
+    SwissTable copy(
+        other, value_traits::propagate_on_container_copy_assignment::value
+                   ? other.alloc_
+                   : alloc_);
+    take(copy);
+    return *this;
+  }  // the copy is made first, so a throwing copy leaves *this untouched
+
+  SwissTable &operator=(SwissTable &&other) &noexcept(
+      (value_traits::propagate_on_container_move_assignment::value ||
+       value_traits::is_always_equal::value) &&
+      std::is_nothrow_copy_assignable_v<Hash> &&
+      std::is_nothrow_copy_assignable_v<KeyEqual>) {
+    if (this == &other) return *this;
+    if constexpr (!value_traits::propagate_on_container_move_assignment::
+                      value) {
+      if (alloc_ != other.alloc_) {
+        clear();
+        hash_ = other.hash_;
+        equal_ = other.equal_;
+        reserve(other.size_);
+        for (size_type i = 0; i < other.capacity_; ++i) {
+          if (other.ctrl_[i] >= 0) insert_unique(std::move(other.slots_[i]));
+        }
+        other.clear();
+        return *this;
+      }
+    }
+    take(other);
+    return *this;
+  }
+
+  allocator_type get_allocator() const noexcept { return alloc_; }
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  const_iterator begin() const noexcept {
+    if (capacity_ == 0) return end();
+    const_iterator it(ctrl_, slots_);
+    if (*ctrl_ < kSentinel) ++it;
+    return it;
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min<size_type>(SIZE_MAX / (sizeof(Key) + 1) / 2,
+                               value_traits::max_size(alloc_));
+  }
+
+  size_type bucket_count() const noexcept { return capacity_; }
+  float load_factor() const noexcept {
+    return capacity_ == 0 ? 0.0f
+                          : static_cast<float>(size_) /
+                                static_cast<float>(capacity_);
+  }
+  float max_load_factor() const noexcept { return 0.875f; }
+
+  // Rebuilds the table with at least n slots, and no fewer than the current
+  // size needs. The slot count is a power of two and may shrink.
+  void rehash(size_type n) {
+    size_type slots = kWidth;
+    while (slots < n || max_fill(slots) < size_) slots *= 2;
+    if (slots != capacity_) rebuild(slots);
+  }
+  void reserve(size_type n) {
+    if (n > size_ + growth_left_) {
+      size_type slots = kWidth;
+      while (max_fill(slots) < n) slots *= 2;
+      rebuild(slots);
+    }
+  }  // makes room for n values without another rebuild
+
+  void clear() noexcept {
+    destroy_values();
+    if (capacity_ != 0) std::memset(ctrl_, kEmpty, capacity_);
+    size_ = 0;
+    growth_left_ = max_fill(capacity_);
+  }  // keeps the slots
+
+  void swap(SwissTable &other) noexcept(
+      std::is_nothrow_swappable_v<Hash> &&
+      std::is_nothrow_swappable_v<KeyEqual>) {
+    using std::swap;
+    swap(hash_, other.hash_);
+    swap(equal_, other.equal_);
+    if constexpr (value_traits::propagate_on_container_swap::value)
+      swap(alloc_, other.alloc_);
+    swap(ctrl_, other.ctrl_);
+    swap(slots_, other.slots_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(growth_left_, other.growth_left_);
+  }  // without propagation the allocators must compare equal
+
+  // Inserts value unless an equal key is already here. Lookup runs first, so
+  // a value that is present costs no copy or move.
+  template <class V>
+  std::pair<iterator, bool> insert_unique(V &&value) {
+    const std::size_t hash = mix(hash_(value));
+    const size_type found = find_index(value, hash);
+    if (found != npos) return {make_iterator(found), false};
+    size_type pos = capacity_ == 0 ? npos : find_free(hash);
+    if (pos == npos || (growth_left_ == 0 && ctrl_[pos] == kEmpty)) {
+      grow();
+      pos = find_free(hash);
+    }
+    construct_value(slots_ + pos, std::forward<V>(value));
+    if (ctrl_[pos] == kEmpty) --growth_left_;
+    ctrl_[pos] = h2(hash);
+    ++size_;
+    return {make_iterator(pos), true};
+  }  // a deleted marker is reused without counting against growth
+
+  iterator erase(const_iterator pos) {
+    const size_type i = pos.ctrl_ - ctrl_;
+    erase_at(i);
+    const_iterator next(ctrl_ + i, slots_ + i);
+    return ++next;
+  }
+
+  template <class K>
+  size_type erase_key(const K &key) {
+    const size_type i = find_index(key, mix(hash_(key)));
+    if (i == npos) return 0;
+    erase_at(i);
+    return 1;
+  }
+
+  void merge(SwissTable &other) {
+    if (this == &other) return;
+    for (size_type i = 0; i < other.capacity_; ++i) {
+      if (other.ctrl_[i] >= 0 &&
+          insert_unique(std::move(other.slots_[i])).second)
+        other.erase_at(i);
+    }
+  }  // values whose keys are already here stay in other
+
+  // Lookups take a key_type, or with a transparent Hash and KeyEqual
+  // anything they accept.
+  template <class K>
+  const_iterator find(const K &key) const noexcept {
+    const size_type i = find_index(key, mix(hash_(key)));
+    return i == npos ? end() : make_iterator(i);
+  }
+  template <class K>
+  bool contains(const K &key) const noexcept {
+    return find_index(key, mix(hash_(key))) != npos;
+  }
+
+ private:
+  static constexpr size_type npos = static_cast<size_type>(-1);
+
+  Hash hash_;
+  KeyEqual equal_;
+  Allocator alloc_;
+  ctrl_t *ctrl_ = nullptr;  // capacity_ + 1 bytes, the last a sentinel
+  Key *slots_ = nullptr;
+  size_type capacity_ = 0;  // a power of two, at least kWidth
+  size_type size_ = 0;
+  size_type growth_left_ = 0;  // empty slots an insert may still take
+
+  // std::hash of an integer is the integer itself; the multiply spreads it
+  // over the high bits that pick the group, and the fold brings high bits
+  // down into the seven kept in the control byte.
+  static std::size_t mix(std::size_t hash) noexcept {
+    const auto product =
+        static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(product ^ (product >> 32));
+  }
+  static ctrl_t h2(std::size_t hash) noexcept {
+    return static_cast<ctrl_t>(hash & 0x7F);
+  }
+  size_type first_group(std::size_t hash) const noexcept {
+    return (hash >> 7) & (capacity_ / kWidth - 1);
+  }
+  static size_type max_fill(size_type slots) noexcept {
+    return slots - slots / 8;
+  }
+
+  const_iterator make_iterator(size_type i) const noexcept {
+    return const_iterator(ctrl_ + i, slots_ + i);
+  }
+
+  // Walks the groups from the hash's first one, quadratically; with a
+  // power-of-two group count the triangular steps reach every group.
+  template <class K>
+  size_type find_index(const K &key, std::size_t hash) const noexcept {
+    if (size_ == 0) return npos;
+    const size_type mask = capacity_ / kWidth - 1;
+    size_type group = first_group(hash);
+    for (size_type step = 1;; group = (group + step++) & mask) {
+      const size_type base = group * kWidth;
+      const Group g(ctrl_ + base);
+      for (BitMask m = g.match(h2(hash)); m; m.clear_lowest()) {
+        const size_type i = base + m.lowest();
+        if (equal_(slots_[i], key)) return i;
+      }
+      if (g.match_empty()) return npos;
+      if (step > mask) return npos;
+    }
+  }
+
+  size_type find_free(std::size_t hash) const noexcept {
+    const size_type mask = capacity_ / kWidth - 1;
+    size_type group = first_group(hash);
+    for (size_type step = 1;; group = (group + step++) & mask) {
+      const size_type base = group * kWidth;
+      const BitMask m = Group(ctrl_ + base).match_empty_or_deleted();
+      if (m) return base + m.lowest();
+    }
+  }  // the table always has a free slot, growth_left_ keeps one back
+
+  void erase_at(size_type i) noexcept {
+    destroy_value(slots_ + i);
+    const size_type base = i / kWidth * kWidth;
+    if (Group(ctrl_ + base).match_empty()) {
+      ctrl_[i] = kEmpty;
+      ++growth_left_;
+    } else {
+      ctrl_[i] = kDeleted;
+    }
+    --size_;
+  }  // probes stop at a group with an empty slot, so none pass through i
+
+  void grow() {
+    rebuild(size_ < max_fill(capacity_) / 2 ? std::max(capacity_, kWidth)
+                                            : std::max(capacity_ * 2, kWidth));
+  }  // a table mostly full of deleted markers is rebuilt at the same size
+
+  void rebuild(size_type slots) {
+    ctrl_t *old_ctrl = ctrl_;
+    Key *old_slots = slots_;
+    const size_type old_capacity = capacity_;
+    allocate(slots);
+    for (size_type i = 0; i < old_capacity; ++i) {
+      if (old_ctrl[i] < 0) continue;
+      const std::size_t hash = mix(hash_(old_slots[i]));
+      const size_type pos = find_free(hash);
+      construct_value(slots_ + pos, std::move_if_noexcept(old_slots[i]));
+      destroy_value(old_slots + i);
+      ctrl_[pos] = h2(hash);
+    }
+    growth_left_ = max_fill(capacity_) - size_;
+    release(old_ctrl, old_slots, old_capacity);
+  }
+
+  void allocate(size_type slots) {
+    ctrl_allocator ctrl_alloc(alloc_);
+    ctrl_t *ctrl = ctrl_traits::allocate(ctrl_alloc, slots + 1);
+    try {
+      slots_ = value_traits::allocate(alloc_, slots);
+    } catch (...) {
+      ctrl_traits::deallocate(ctrl_alloc, ctrl, slots + 1);
+      throw;
+    }
+    ctrl_ = ctrl;
+    capacity_ = slots;
+    std::memset(ctrl_, kEmpty, slots);
+    ctrl_[slots] = kSentinel;
+    growth_left_ = max_fill(slots);
+  }
+
+  void release(ctrl_t *ctrl, Key *slots, size_type capacity) noexcept {
+    if (ctrl == nullptr) return;
+    ctrl_allocator ctrl_alloc(alloc_);
+    ctrl_traits::deallocate(ctrl_alloc, ctrl, capacity + 1);
+    value_traits::deallocate(alloc_, slots, capacity);
+  }
+  void release() noexcept {
+    release(ctrl_, slots_, capacity_);
+    forget();
+  }
+
+  template <class... Args>
+  void construct_value(Key *where, Args &&...args) {
+    value_traits::construct(alloc_, where, std::forward<Args>(args)...);
+  }
+  void destroy_value(Key *value) noexcept {
+    value_traits::destroy(alloc_, value);
+  }
+  void destroy_values() noexcept {
+    if (size_ == 0) return;
+    for (size_type i = 0; i < capacity_; ++i) {
+      if (ctrl_[i] >= 0) destroy_value(slots_ + i);
+    }
+  }
+
+  void forget() noexcept {
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growth_left_ = 0;
+  }
+
+  void take(SwissTable &other) noexcept {
+    destroy_values();
+    release();
+    hash_ = other.hash_;
+    equal_ = other.equal_;
+    if constexpr (value_traits::propagate_on_container_move_assignment::
+                      value ||
+                  value_traits::propagate_on_container_copy_assignment::
+                      value)
+      alloc_ = other.alloc_;
+    ctrl_ = other.ctrl_;
+    slots_ = other.slots_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+    other.forget();
+  }  // steals other's storage, the allocators must be interchangeable
+};
+}  // namespace SwissTable
+
+#endif  // CPP2_S21_CONTAINERS_1_SWISSTABLE_H
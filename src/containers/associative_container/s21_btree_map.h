@@ -0,0 +1,181 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+
+#include "BTree.h"
+
+namespace s21 {
+// Drop-in for s21::map backed by a B-tree, see btree_set. Entries move
+// between nodes as the map changes, so any insert or erase invalidates all
+// iterators and references.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = PoolAllocator<std::pair<const Key, T>>,
+          size_t NodeBytes = 256>
+class btree_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using tree_type = BTree::BTree<value_type, Compare, Allocator,
+                                 BinaryTree::SelectFirst, NodeBytes>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  btree_map() : tree_() {}
+  explicit btree_map(const allocator_type &alloc) : tree_(alloc) {}
+  explicit btree_map(const Compare &comp,
+                     const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit btree_map(std::initializer_list<value_type> const &items,
+                     const allocator_type &alloc = allocator_type())
+      : btree_map(items, Compare(), alloc) {}
+  btree_map(std::initializer_list<value_type> const &items,
+            const Compare &comp,
+            const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(items.begin(), items.end(), true);
+  }
+  template <class InputIt>
+  btree_map(InputIt first, InputIt last,
+            const allocator_type &alloc = allocator_type())
+      : btree_map(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  btree_map(InputIt first, InputIt last, const Compare &comp,
+            const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, true);
+  }  // O(n) for sorted input, unsorted input is sorted first
+  btree_map(const btree_map &m) : tree_(m.tree_) {}
+  btree_map(btree_map &&m) noexcept(
+      std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(m.tree_)) {}
+  ~btree_map() = default;
+
+  btree_map &operator=(btree_map &&m) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
+    if (this == &m) return *this;
+    tree_ = std::move(m.tree_);
+    return *this;
+  }
+  btree_map &operator=(const btree_map &m) & {
+    if (this == &m) return *this;
+    tree_ = m.tree_;
+    return *this;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insert(value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return tree_.insert(value_type(key, obj));
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto it = tree_.find(key);
+    if (it == end()) return tree_.insert(value_type(key, obj));
+    (*it).second = obj;
+    return {it, false};
+  }
+
+  void swap(btree_map &other) noexcept { tree_.swap(other.tree_); }
+  void merge(btree_map &other) { tree_.merge(other.tree_); }
+
+  iterator begin() { return tree_.begin(); }
+  const_iterator begin() const { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator end() const { return tree_.end(); }
+  void erase(iterator pos) { tree_.erase(pos); }
+  T &at(const Key &key) & { return tree_.at(key).second; }
+  const T &at(const Key &key) const & { return tree_.at(key).second; }
+  T &operator[](const Key &key) & {
+    auto it = tree_.find(key);
+    if (it == end()) it = tree_.insert(value_type(key, mapped_type())).first;
+    return (*it).second;
+  }  // the mapped value is default-constructed only when key is missing
+
+  iterator find(const Key &key) noexcept { return tree_.find(key); }
+  const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+
+  size_type count(const Key &key) const noexcept { return tree_.count(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+  iterator lower_bound(const Key &key) noexcept {
+    return tree_.lower_bound(key);
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key &key) noexcept {
+    return tree_.upper_bound(key);
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static btree_map from_sorted(InputIt first, InputIt last) {
+    btree_map result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, true);
+  }  // replaces the contents, fills the nodes in one pass
+
+  [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return tree_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept { return tree_.max_size(); }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+  // Orders whole entries by their keys with a copy of the map's comparator.
+  class value_compare {
+   public:
+    bool operator()(const value_type &left, const value_type &right) const {
+      return comp(left.first, right.first);
+    }
+
+   protected:
+    friend class btree_map;
+    explicit value_compare(Compare c) : comp(std::move(c)) {}
+
+    Compare comp;
+  };
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return value_compare(tree_.key_comp()); }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
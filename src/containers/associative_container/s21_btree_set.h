@@ -0,0 +1,148 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+
+#include "BTree.h"
+
+namespace s21 {
+// Drop-in for s21::set backed by a B-tree: values sit in arrays of up to
+// NodeBytes, so lookups miss cache once per level rather than per key. Any
+// insert or erase invalidates all iterators.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = PoolAllocator<Key>, size_t NodeBytes = 256>
+class btree_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = BTree::BTree<key_type, Compare, Allocator,
+                                 BinaryTree::Identity, NodeBytes>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  btree_set() : tree_() {}
+  explicit btree_set(const allocator_type &alloc) : tree_(alloc) {}
+  explicit btree_set(const Compare &comp,
+                     const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit btree_set(std::initializer_list<value_type> const &items,
+                     const allocator_type &alloc = allocator_type())
+      : btree_set(items, Compare(), alloc) {}
+  btree_set(std::initializer_list<value_type> const &items,
+            const Compare &comp,
+            const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(items.begin(), items.end(), true);
+  }
+  template <class InputIt>
+  btree_set(InputIt first, InputIt last,
+            const allocator_type &alloc = allocator_type())
+      : btree_set(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  btree_set(InputIt first, InputIt last, const Compare &comp,
+            const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, true);
+  }  // O(n) for sorted input, unsorted input is sorted first
+  btree_set(const btree_set &s) : tree_(s.tree_) {}
+  btree_set(btree_set &&s) noexcept(
+      std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(s.tree_)) {}
+  ~btree_set() = default;
+
+  btree_set &operator=(btree_set &&s) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
+    if (this == &s) return *this;
+    tree_ = std::move(s.tree_);
+    return *this;
+  }
+  btree_set &operator=(const btree_set &s) & {
+    if (this == &s) return *this;
+    tree_ = s.tree_;
+    return *this;
+  }
+
+  iterator begin() { return tree_.begin(); }
+  const_iterator begin() const { return tree_.begin(); }
+  iterator end() { return tree_.end(); }
+  const_iterator end() const { return tree_.end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return tree_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept { return tree_.max_size(); }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+
+  void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static btree_set from_sorted(InputIt first, InputIt last) {
+    btree_set result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, true);
+  }  // replaces the contents, fills the nodes in one pass
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tree_.insert(value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tree_.insert(std::move(value));
+  }
+  void erase(iterator pos) { tree_.erase(pos); }
+  void swap(btree_set &other) noexcept { tree_.swap(other.tree_); }
+  void merge(btree_set &other) { tree_.merge(other.tree_); }
+
+  iterator find(const Key &key) noexcept { return tree_.find(key); }
+  const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+
+  size_type count(const Key &key) const noexcept { return tree_.count(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+  iterator lower_bound(const Key &key) noexcept {
+    return tree_.lower_bound(key);
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key &key) noexcept {
+    return tree_.upper_bound(key);
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
@@ -0,0 +1,139 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_HASH_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_HASH_SET_H
+
+#include "SwissTable.h"
+
+namespace s21 {
+// Hash set for membership checks on large sets: a probe compares a whole
+// group of control bytes with one SIMD instruction and reads a key only on
+// a seven-bit hash match, so misses rarely touch a key at all. Unlike
+// unordered_set, values never move on erase; only an insert that rebuilds
+// the table invalidates iterators to other values.
+template <class Key, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<Key>>
+class flat_hash_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type = SwissTable::SwissTable<key_type, Hash, KeyEqual,
+                                            Allocator>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  flat_hash_set() : table_() {}
+  explicit flat_hash_set(const allocator_type &alloc) : table_(alloc) {}
+  explicit flat_hash_set(size_type buckets, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual(),
+                         const allocator_type &alloc = allocator_type())
+      : table_(buckets, hash, equal, alloc) {}
+  explicit flat_hash_set(std::initializer_list<value_type> const &items,
+                         const allocator_type &alloc = allocator_type())
+      : table_(alloc) {
+    insert(items.begin(), items.end());
+  }
+  template <class InputIt>
+  flat_hash_set(InputIt first, InputIt last,
+                const allocator_type &alloc = allocator_type())
+      : table_(alloc) {
+    insert(first, last);
+  }
+  flat_hash_set(const flat_hash_set &s) : table_(s.table_) {}
+  flat_hash_set(flat_hash_set &&s) noexcept(
+      std::is_nothrow_move_constructible_v<table_type>)
+      : table_(std::move(s.table_)) {}
+  ~flat_hash_set() = default;
+
+  flat_hash_set &operator=(flat_hash_set &&s) &noexcept(
+      std::is_nothrow_move_assignable_v<table_type>) {
+    if (this == &s) return *this;
+    table_ = std::move(s.table_);
+    return *this;
+  }
+  flat_hash_set &operator=(const flat_hash_set &s) & {
+    if (this == &s) return *this;
+    table_ = s.table_;
+    return *this;
+  }
+
+  const_iterator begin() const noexcept { return table_.begin(); }
+  const_iterator end() const noexcept { return table_.end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return table_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return table_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return table_.max_size();
+  }
+
+  void clear() noexcept { table_.clear(); }
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.insert_unique(value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.insert_unique(std::move(value));
+  }
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+      reserve(size() + std::distance(first, last));
+    for (; first != last; ++first) insert(*first);
+  }  // sizes the table once for forward ranges
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    reserve(size() + sizeof...(Args));
+    (insert(std::forward<Args>(args)), ...);
+  }
+  template <class... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return table_.insert_unique(value_type(std::forward<Args>(args)...));
+  }
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const Key &key) { return table_.erase_key(key); }
+  void swap(flat_hash_set &other) noexcept { table_.swap(other.table_); }
+  void merge(flat_hash_set &other) { table_.merge(other.table_); }
+
+  const_iterator find(const Key &key) const noexcept {
+    return table_.find(key);
+  }
+  bool contains(const Key &key) const noexcept { return table_.contains(key); }
+  size_type count(const Key &key) const noexcept {
+    return table_.contains(key) ? 1 : 0;
+  }
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return table_.find(key);
+  }
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return table_.contains(key);
+  }  // heterogeneous lookup, only with a transparent Hash and KeyEqual
+
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void rehash(size_type buckets) { table_.rehash(buckets); }
+  void reserve(size_type n) { table_.reserve(n); }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const noexcept {
+    return table_.get_allocator();
+  }
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_HASH_SET_H
@@ -0,0 +1,490 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+
+#include "FlatTree.h"
+
+namespace s21 {
+// s21::map over two parallel s21::Vector arrays, one of sorted keys and one
+// of mapped values. Lookups binary-search the keys alone, so the values never
+// dilute the cache lines a search walks through. Single inserts and erases
+// are O(n); load batches with the range insert, insert_many or assign_sorted.
+//
+// There is no pair in memory to point at: dereferencing an iterator yields a
+// pair of references, std::pair<const Key &, T &>. Insert and erase
+// invalidate iterators.
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = std::allocator<std::pair<Key, T>>>
+class flat_map : private BinaryTree::CompareHolder<Compare> {
+ private:
+  using compare_holder = BinaryTree::CompareHolder<Compare>;
+  using compare_holder::comp;
+  using value_traits = std::allocator_traits<Allocator>;
+
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = std::pair<const key_type &, mapped_type &>;
+  using const_reference = std::pair<const key_type &, const mapped_type &>;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using key_container = s21::Vector<
+      key_type, typename value_traits::template rebind_alloc<key_type>>;
+  using mapped_container = s21::Vector<
+      mapped_type, typename value_traits::template rebind_alloc<mapped_type>>;
+
+  template <class Mapped>
+  struct basic_iterator {
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::pair<key_type, mapped_type>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::pair<const key_type &, Mapped &>;
+    struct pointer {
+      reference ref_;
+      const reference *operator->() const noexcept { return &ref_; }
+    };  // keeps the pair of references alive for it->second
+
+    const key_type *key_;
+    Mapped *mapped_;
+
+    basic_iterator() : key_(nullptr), mapped_(nullptr) {}
+    basic_iterator(const key_type *key, Mapped *mapped)
+        : key_(key), mapped_(mapped) {}
+    template <class Other, class = std::enable_if_t<
+                               std::is_same_v<const Other, Mapped> &&
+                               !std::is_same_v<Other, Mapped>>>
+    basic_iterator(const basic_iterator<Other> &other)  // NOLINT
+        : key_(other.key_), mapped_(other.mapped_) {}
+
+    reference operator*() const { return {*key_, *mapped_}; }
+    pointer operator->() const { return pointer{**this}; }
+    reference operator[](difference_type n) const {
+      return {key_[n], mapped_[n]};
+    }
+
+    basic_iterator &operator++() noexcept {
+      ++key_;
+      ++mapped_;
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator previous = *this;
+      ++*this;
+      return previous;
+    }
+    basic_iterator &operator--() noexcept {
+      --key_;
+      --mapped_;
+      return *this;
+    }
+    basic_iterator operator--(int) noexcept {
+      basic_iterator previous = *this;
+      --*this;
+      return previous;
+    }
+    basic_iterator &operator+=(difference_type n) noexcept {
+      key_ += n;
+      mapped_ += n;
+      return *this;
+    }
+    basic_iterator &operator-=(difference_type n) noexcept {
+      return *this += -n;
+    }
+    friend basic_iterator operator+(basic_iterator it, difference_type n) {
+      return it += n;
+    }
+    friend basic_iterator operator+(difference_type n, basic_iterator it) {
+      return it += n;
+    }
+    friend basic_iterator operator-(basic_iterator it, difference_type n) {
+      return it -= n;
+    }
+    friend difference_type operator-(const basic_iterator &a,
+                                     const basic_iterator &b) noexcept {
+      return a.key_ - b.key_;
+    }
+
+    friend bool operator==(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return a.key_ == b.key_;
+    }
+    friend bool operator!=(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return a.key_ != b.key_;
+    }
+    friend bool operator<(const basic_iterator &a,
+                          const basic_iterator &b) noexcept {
+      return a.key_ < b.key_;
+    }
+    friend bool operator>(const basic_iterator &a,
+                          const basic_iterator &b) noexcept {
+      return b < a;
+    }
+    friend bool operator<=(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return !(b < a);
+    }
+    friend bool operator>=(const basic_iterator &a,
+                           const basic_iterator &b) noexcept {
+      return !(a < b);
+    }
+  };
+
+  using iterator = basic_iterator<mapped_type>;
+  using const_iterator = basic_iterator<const mapped_type>;
+
+  flat_map() : flat_map(Compare(), Allocator()) {}
+  explicit flat_map(const allocator_type &alloc) : flat_map(Compare(), alloc) {}
+  explicit flat_map(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : compare_holder(comp),
+        keys_(typename key_container::allocator_type(alloc)),
+        values_(typename mapped_container::allocator_type(alloc)) {}
+  explicit flat_map(std::initializer_list<value_type> const &items,
+                    const allocator_type &alloc = allocator_type())
+      : flat_map(items, Compare(), alloc) {}
+  flat_map(std::initializer_list<value_type> const &items, const Compare &comp,
+           const allocator_type &alloc = allocator_type())
+      : flat_map(comp, alloc) {
+    insert(items.begin(), items.end());
+  }
+  template <class InputIt>
+  flat_map(InputIt first, InputIt last,
+           const allocator_type &alloc = allocator_type())
+      : flat_map(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  flat_map(InputIt first, InputIt last, const Compare &comp,
+           const allocator_type &alloc = allocator_type())
+      : flat_map(comp, alloc) {
+    insert(first, last);
+  }  // O(n) for sorted input, unsorted input is sorted first
+  flat_map(const flat_map &m)
+      : compare_holder(m.comp()), keys_(m.keys_), values_(m.values_) {}
+  flat_map(flat_map &&m) noexcept(std::is_nothrow_copy_constructible_v<Compare>)
+      : compare_holder(m.comp()),
+        keys_(std::move(m.keys_)),
+        values_(std::move(m.values_)) {}
+  ~flat_map() = default;
+
+  flat_map &operator=(flat_map &&m) &noexcept(
+      std::is_nothrow_move_assignable_v<key_container> &&
+      std::is_nothrow_move_assignable_v<mapped_container> &&
+      std::is_nothrow_copy_assignable_v<Compare>) {
+    if (this == &m) return *this;
+    comp() = m.comp();
+    keys_ = std::move(m.keys_);
+    values_ = std::move(m.values_);
+    return *this;
+  }
+  flat_map &operator=(const flat_map &m) & {
+    if (this == &m) return *this;
+    constexpr bool kPropagate =
+        value_traits::propagate_on_container_copy_assignment::value;
+    key_container keys(m.keys_, kPropagate ? m.keys_.Get_Allocator()
+                                           : keys_.Get_Allocator());
+    mapped_container values(m.values_, kPropagate ? m.values_.Get_Allocator()
+                                                  : values_.Get_Allocator());
+    comp() = m.comp();
+    keys_ = std::move(keys);
+    values_ = std::move(values);
+    return *this;
+  }  // the copies are made first, so a throwing copy leaves *this untouched
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return try_insert(value.first, value.second);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return try_insert(std::move(value.first), std::move(value.second));
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return try_insert(key, obj);
+  }
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = try_insert(key, obj);
+    if (!result.second) (*result.first).second = obj;
+    return result;
+  }
+  // Collects [first, last), sorts it by key and merges it with the current
+  // entries in one pass. The entry that was already here wins, then the
+  // first of equal keys in the range.
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    s21::Vector<value_type, allocator_type> batch(get_allocator());
+    for (; first != last; ++first) batch.Emplace_Back(*first);
+    merge_batch(batch);
+  }
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    s21::Vector<value_type, allocator_type> batch(get_allocator());
+    batch.Reserve(sizeof...(Args));
+    (batch.Emplace_Back(std::forward<Args>(args)), ...);
+    merge_batch(batch);
+  }  // a batched insert, iterators from earlier calls would not survive it
+
+  void swap(flat_map &other) noexcept(std::is_nothrow_swappable_v<Compare>) {
+    using std::swap;
+    swap(comp(), other.comp());
+    keys_.Swap(other.keys_);
+    values_.Swap(other.values_);
+  }
+  void merge(flat_map &other) {
+    if (this == &other) return;
+    s21::Vector<value_type, allocator_type> batch(get_allocator());
+    size_type kept = 0;
+    for (size_type i = 0; i < other.size(); ++i) {
+      if (contains(other.keys_[i])) {
+        if (kept != i) {
+          other.keys_[kept] = std::move(other.keys_[i]);
+          other.values_[kept] = std::move(other.values_[i]);
+        }
+        ++kept;
+      } else {
+        batch.Emplace_Back(std::move(other.keys_[i]),
+                           std::move(other.values_[i]));
+      }
+    }
+    other.erase_tail(kept);
+    merge_batch(batch);
+  }  // entries whose keys are already here stay in other
+
+  iterator begin() noexcept { return make_iterator(0); }
+  const_iterator begin() const noexcept { return make_iterator(0); }
+  iterator end() noexcept { return make_iterator(size()); }
+  const_iterator end() const noexcept { return make_iterator(size()); }
+  iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_type from = first - begin();
+    const size_type count = last - first;
+    if (count != 0) {
+      std::move(keys_.Begin() + from + count, keys_.End(),
+                keys_.Begin() + from);
+      std::move(values_.Begin() + from + count, values_.End(),
+                values_.Begin() + from);
+      erase_tail(size() - count);
+    }
+    return make_iterator(from);
+  }  // shifts both arrays once for the whole range
+  size_type erase(const Key &key) {
+    auto it = find(key);
+    if (it == end()) return 0;
+    erase(it);
+    return 1;
+  }
+  T &at(const Key &key) & {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("Key not found in flat_map");
+    return *it.mapped_;
+  }
+  const T &at(const Key &key) const & {
+    auto it = find(key);
+    if (it == end()) throw std::out_of_range("Key not found in flat_map");
+    return *it.mapped_;
+  }
+  T &operator[](const Key &key) & {
+    const size_type i = lower_index(key);
+    if (i == size() || comp()(key, keys_[i]))
+      return *emplace_at(i, key, mapped_type()).mapped_;
+    return values_[i];
+  }  // the mapped value is default-constructed only when key is missing
+
+  iterator find(const Key &key) noexcept { return find_equal(key); }
+  const_iterator find(const Key &key) const noexcept {
+    return find_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return find_equal(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return find_equal(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+  bool contains(const Key &key) const noexcept {
+    return find_equal(key) != end();
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return find_equal(key) != end();
+  }
+
+  size_type count(const Key &key) const noexcept {
+    return contains(key) ? 1 : 0;
+  }
+  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return {lower_bound(key), upper_bound(key)};
+  }
+  iterator lower_bound(const Key &key) noexcept {
+    return make_iterator(lower_index(key));
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return make_iterator(lower_index(key));
+  }
+  iterator upper_bound(const Key &key) noexcept {
+    return make_iterator(upper_index(key));
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return make_iterator(upper_index(key));
+  }
+
+  iterator nth_element(size_type k) noexcept {
+    return make_iterator(std::min(k, size()));
+  }
+  const_iterator nth_element(size_type k) const noexcept {
+    return make_iterator(std::min(k, size()));
+  }
+  size_type rank(const Key &key) const noexcept { return lower_index(key); }
+  size_type count_range(const Key &lo, const Key &hi) const noexcept {
+    if (!comp()(lo, hi)) return 0;
+    return lower_index(hi) - lower_index(lo);
+  }  // keys in [lo, hi)
+
+  const key_container &keys() const noexcept { return keys_; }
+  const mapped_container &values() const noexcept { return values_; }
+
+  void clear() noexcept {
+    keys_.Clear();
+    values_.Clear();
+  }
+  template <class InputIt>
+  static flat_map from_sorted(InputIt first, InputIt last) {
+    flat_map result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    clear();
+    insert(first, last);
+  }  // replaces the contents, copies sorted input in one pass
+
+  [[nodiscard]] bool empty() const noexcept { return keys_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return keys_.Size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return std::min(keys_.Max_Size(), values_.Max_Size());
+  }
+  size_type capacity() const noexcept { return keys_.Capacity(); }
+  void reserve(size_type n) {
+    keys_.Reserve(n);
+    values_.Reserve(n);
+  }
+  void shrink_to_fit() {
+    keys_.Shrink_To_Fit();
+    values_.Shrink_To_Fit();
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return allocator_type(keys_.Get_Allocator());
+  }
+
+  // Orders whole entries by their keys with a copy of the map's comparator.
+  class value_compare {
+   public:
+    bool operator()(const value_type &left, const value_type &right) const {
+      return comp(left.first, right.first);
+    }
+
+   protected:
+    friend class flat_map;
+    explicit value_compare(Compare c) : comp(std::move(c)) {}
+
+    Compare comp;
+  };
+
+  key_compare key_comp() const { return comp(); }
+  value_compare value_comp() const { return value_compare(comp()); }
+
+ private:
+  key_container keys_;
+  mapped_container values_;
+
+  iterator make_iterator(size_type i) noexcept {
+    return iterator(keys_.Data() + i, values_.Data() + i);
+  }
+  const_iterator make_iterator(size_type i) const noexcept {
+    return const_cast<flat_map *>(this)->make_iterator(i);
+  }
+
+  template <class K>
+  size_type lower_index(const K &key) const noexcept {
+    return FlatTree::lower_index(make_iterator(0).key_, size(), key, comp());
+  }
+  template <class K>
+  size_type upper_index(const K &key) const noexcept {
+    return FlatTree::upper_index(make_iterator(0).key_, size(), key, comp());
+  }
+  template <class K>
+  iterator find_equal(const K &key) const noexcept {
+    size_type i = lower_index(key);
+    if (i == size() || comp()(key, keys_[i])) i = size();
+    return const_cast<flat_map *>(this)->make_iterator(i);
+  }
+
+  template <class K, class M>
+  std::pair<iterator, bool> try_insert(K &&key, M &&obj) {
+    const size_type i = lower_index(key);
+    if (i != size() && !comp()(key, keys_[i])) return {make_iterator(i), false};
+    return {emplace_at(i, std::forward<K>(key), std::forward<M>(obj)), true};
+  }
+
+  template <class K, class M>
+  iterator emplace_at(size_type i, K &&key, M &&obj) {
+    values_.Emplace(values_.Cbegin() + i, std::forward<M>(obj));
+    try {
+      keys_.Emplace(keys_.Cbegin() + i, std::forward<K>(key));
+    } catch (...) {
+      values_.Erase(values_.Begin() + i);
+      throw;
+    }
+    return make_iterator(i);
+  }  // the arrays stay the same length even if the key fails to copy
+
+  void erase_tail(size_type new_size) noexcept {
+    while (keys_.Size() > new_size) {
+      keys_.Pop_Back();
+      values_.Pop_Back();
+    }
+  }
+
+  // Merges a batch of entries into fresh arrays and swaps them in. Entries
+  // already here are moved only if that cannot throw, so a failure leaves
+  // the map as it was.
+  void merge_batch(s21::Vector<value_type, allocator_type> &batch) {
+    const size_type count = batch.Size();
+    if (count == 0) return;
+    auto less = [this](const value_type &a, const value_type &b) {
+      return comp()(a.first, b.first);
+    };
+    if (!std::is_sorted(batch.Begin(), batch.End(), less))
+      std::stable_sort(batch.Begin(), batch.End(), less);
+    key_container keys(keys_.Get_Allocator());
+    mapped_container values(values_.Get_Allocator());
+    keys.Reserve(size() + count);
+    values.Reserve(size() + count);
+    size_type i = 0;
+    size_type j = 0;
+    while (i < size() || j < count) {
+      if (j == count || (i < size() && !comp()(batch[j].first, keys_[i]))) {
+        while (j < count && !comp()(keys_[i], batch[j].first)) ++j;
+        keys.Push_Back(std::move_if_noexcept(keys_[i]));
+        values.Push_Back(std::move_if_noexcept(values_[i]));
+        ++i;
+      } else {
+        keys.Push_Back(std::move(batch[j].first));
+        values.Push_Back(std::move(batch[j].second));
+        const Key &taken = keys.Back();
+        ++j;
+        while (j < count && !comp()(taken, batch[j].first)) ++j;
+      }
+    }
+    keys_ = std::move(keys);
+    values_ = std::move(values);
+  }
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
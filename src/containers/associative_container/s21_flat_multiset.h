@@ -0,0 +1,169 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_MULTISET_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_MULTISET_H
+
+#include "FlatTree.h"
+
+namespace s21 {
+// s21::multiset over one sorted s21::Vector, see flat_set. Equal keys sit
+// next to each other in insertion order, so count and equal_range are two
+// binary searches.
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = std::allocator<Key>>
+class flat_multiset {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = FlatTree::FlatTree<key_type, Compare, Allocator>;
+  using iterator = typename tree_type::iterator;
+  using const_iterator = typename tree_type::const_iterator;
+
+  flat_multiset() : tree_() {}
+  explicit flat_multiset(const allocator_type &alloc) : tree_(alloc) {}
+  explicit flat_multiset(const Compare &comp,
+                         const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit flat_multiset(std::initializer_list<value_type> const &items,
+                         const allocator_type &alloc = allocator_type())
+      : flat_multiset(items, Compare(), alloc) {}
+  flat_multiset(std::initializer_list<value_type> const &items,
+                const Compare &comp,
+                const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(items.begin(), items.end(), false);
+  }
+  template <class InputIt>
+  flat_multiset(InputIt first, InputIt last,
+                const allocator_type &alloc = allocator_type())
+      : flat_multiset(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  flat_multiset(InputIt first, InputIt last, const Compare &comp,
+                const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, false);
+  }  // O(n) for sorted input, unsorted input is sorted first
+  flat_multiset(const flat_multiset &s) : tree_(s.tree_) {}
+  flat_multiset(flat_multiset &&s) noexcept(
+      std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(s.tree_)) {}
+  ~flat_multiset() = default;
+
+  flat_multiset &operator=(flat_multiset &&s) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
+    if (this == &s) return *this;
+    tree_ = std::move(s.tree_);
+    return *this;
+  }
+  flat_multiset &operator=(const flat_multiset &s) & {
+    if (this == &s) return *this;
+    tree_ = s.tree_;
+    return *this;
+  }
+
+  const_iterator begin() const { return tree_.begin(); }
+  const_iterator end() const { return tree_.end(); }
+
+  [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return tree_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept { return tree_.max_size(); }
+  size_type capacity() const noexcept { return tree_.capacity(); }
+  void reserve(size_type n) { tree_.reserve(n); }
+  void shrink_to_fit() { tree_.shrink_to_fit(); }
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+
+  void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static flat_multiset from_sorted(InputIt first, InputIt last) {
+    flat_multiset result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, false);
+  }  // replaces the contents, copies sorted input in one pass
+  iterator insert(const value_type &value) {
+    return tree_.insert_equal(value);
+  }
+  iterator insert(value_type &&value) {
+    return tree_.insert_equal(std::move(value));
+  }
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    tree_.insert_range(first, last, false);
+  }  // one sort and merge for the whole range
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    if constexpr (sizeof...(Args) > 0) {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      tree_.insert_range(std::make_move_iterator(std::begin(items)),
+                         std::make_move_iterator(std::end(items)), false);
+    }
+  }  // a batched insert, iterators from earlier calls would not survive it
+  iterator erase(const_iterator pos) { return tree_.erase(pos); }
+  iterator erase(const_iterator first, const_iterator last) {
+    return tree_.erase(first, last);
+  }
+  size_type erase(const Key &key) {
+    auto range = tree_.equal_range(key);
+    const size_type erased = range.second - range.first;
+    tree_.erase(range.first, range.second);
+    return erased;
+  }
+  void swap(flat_multiset &other) noexcept { tree_.swap(other.tree_); }
+  void merge(flat_multiset &other) {
+    tree_.merge_with_repetitions(other.tree_);
+  }
+
+  const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) const noexcept {
+    return tree_.count(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+
+  size_type count(const Key &key) const noexcept { return tree_.count(key); }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  const_iterator nth_element(size_type k) const noexcept {
+    return tree_.nth_element(k);
+  }
+  size_type rank(const Key &key) const noexcept { return tree_.rank(key); }
+  size_type count_range(const Key &lo, const Key &hi) const noexcept {
+    return tree_.count_range(lo, hi);
+  }
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+
+ private:
+  tree_type tree_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_MULTISET_H
@@ -5,14 +5,14 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_MAP_H
 #define CPP2_S21_CONTAINERS_1_S21_MAP_H
 
+#include <vector>
+
 #include "BinaryTree.h"
 
 namespace s21 {
-template <class Key, class T, class Compare = std::less<Key>>
+template <class Key, class T, class Compare = std::less<Key>,
+          class Allocator = PoolAllocator<std::pair<const Key, T>>>
 class map {
- private:
-  class Comparator;
-
  public:
   using key_type = Key;
   using mapped_type = T;
@@ -20,15 +20,40 @@ class map {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using tree_type = BinaryTree::BinaryTree<value_type, Comparator>;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using tree_type = BinaryTree::BinaryTree<value_type, Compare, Allocator,
+                                           BinaryTree::SelectFirst>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   map() : tree_() {}
-  explicit map(std::initializer_list<value_type> const &items) : tree_(items) {}
+  explicit map(const allocator_type &alloc) : tree_(alloc) {}
+  explicit map(const Compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit map(std::initializer_list<value_type> const &items,
+               const allocator_type &alloc = allocator_type())
+      : tree_(items, alloc) {}
+  map(std::initializer_list<value_type> const &items, const Compare &comp,
+      const allocator_type &alloc = allocator_type())
+      : tree_(items, comp, alloc) {}
+  template <class InputIt>
+  map(InputIt first, InputIt last,
+      const allocator_type &alloc = allocator_type())
+      : map(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  map(InputIt first, InputIt last, const Compare &comp,
+      const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, true);
+  }  // O(n) for sorted input, unsorted input is sorted first
   map(const map &m) : tree_(m.tree_) {}
-  map(map &&m) noexcept : tree_(std::move(m.tree_)) {}
-  ~map() { clear(); }
+  map(map &&m) noexcept(std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(m.tree_)) {}
+  ~map() = default;
 
   std::pair<iterator, bool> insert(const value_type &value) {
     return tree_.insert(value);
@@ -46,29 +71,30 @@ class map {
     return results;
   }
 
-  void swap(map &other) noexcept { std::swap(tree_, other.tree_); }
+  void swap(map &other) noexcept { tree_.swap(other.tree_); }
 
   void merge(map &other) { tree_.merge(other.tree_); }
+  node_type extract(iterator pos) noexcept { return tree_.extract(pos); }
+  node_type extract(const Key &key) { return tree_.extract(key); }
+  insert_return_type insert(node_type &&handle) {
+    return tree_.insert(std::move(handle));
+  }
 
   iterator begin() { return tree_.begin(); }
   const_iterator begin() const { return tree_.begin(); }
   iterator end() { return tree_.end(); }
   const_iterator end() const { return tree_.end(); }
   void erase(iterator pos) noexcept { tree_.erase(pos); }
-  T &at(const Key &key) & {
-    const mapped_type value{};
-    return (tree_.at(std::make_pair(key, value))).second;
-  }
-  const T &at(const Key &key) const & {
-    const mapped_type value{};
-    return (tree_.at(std::make_pair(key, value))).second;
-  }
-  T &operator[](const Key &key) &noexcept {
-    mapped_type value{};
-    return (tree_[std::make_pair(key, value)]).second;
-  }
+  T &at(const Key &key) & { return tree_.at(key).second; }
+  const T &at(const Key &key) const & { return tree_.at(key).second; }
+  T &operator[](const Key &key) & {
+    auto it = tree_.find(key);
+    if (it == end()) it = tree_.insert(value_type(key, mapped_type())).first;
+    return (*it).second;
+  }  // the mapped value is default-constructed only when key is missing
 
-  map &operator=(map &&m) &noexcept {
+  map &operator=(map &&m) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
     if (this == &m) return *this;
     tree_ = std::move(m.tree_);
     return *this;
@@ -78,35 +104,91 @@ class map {
     tree_ = m.tree_;
     return *this;
   }
-  iterator find(const Key &key) noexcept {
-    mapped_type value{};
-    return tree_.find(std::make_pair(key, value));
-  }
-  const_iterator find(const Key &key) const noexcept {
-    mapped_type value{};
-    return tree_.find(std::make_pair(key, value));
+  iterator find(const Key &key) noexcept { return tree_.find(key); }
+  const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return tree_.find(key);
   }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }  // heterogeneous lookup, only with a transparent Compare
   void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static map from_sorted(InputIt first, InputIt last) {
+    map result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, true);
+  }  // replaces the contents, builds a balanced tree in one pass
 
   [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
   [[nodiscard]] size_type size() const noexcept { return tree_.size(); }
   [[nodiscard]] size_type max_size() const noexcept { return tree_.max_size(); }
 
-  bool contains(const Key &key) const noexcept {
-    mapped_type value{};
-    return tree_.contains(std::make_pair(key, value));
+  bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
   }
 
- private:
-  tree_type tree_;
+  size_type count(const Key &key) const noexcept { return tree_.count(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+  iterator lower_bound(const Key &key) noexcept {
+    return tree_.lower_bound(key);
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key &key) noexcept {
+    return tree_.upper_bound(key);
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  iterator nth_element(size_type k) noexcept { return tree_.nth_element(k); }
+  const_iterator nth_element(size_type k) const noexcept {
+    return tree_.nth_element(k);
+  }
+  size_type rank(const Key &key) const noexcept { return tree_.rank(key); }
+  size_type count_range(const Key &lo, const Key &hi) const noexcept {
+    return tree_.count_range(lo, hi);
+  }  // O(log n) order statistics, see BinaryTree
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
 
-  class Comparator {
+  // Orders whole entries by their keys with a copy of the map's comparator.
+  class value_compare {
    public:
-    bool operator()(const value_type &left,
-                    const value_type &right) const noexcept {
-      return Compare{}(left.first, right.first);
+    bool operator()(const value_type &left, const value_type &right) const {
+      return comp(left.first, right.first);
     }
+
+   protected:
+    friend class map;
+    explicit value_compare(Compare c) : comp(std::move(c)) {}
+
+    Compare comp;
   };
+
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return value_compare(tree_.key_comp()); }
+
+ private:
+  tree_type tree_;
 };
 }  // namespace s21
 
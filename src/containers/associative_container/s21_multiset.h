@@ -5,10 +5,13 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_MULTISET_H
 #define CPP2_S21_CONTAINERS_1_S21_MULTISET_H
 
+#include <vector>
+
 #include "BinaryTree.h"
 
 namespace s21 {
-template <class Key, class Compare = std::less<Key>>
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = PoolAllocator<Key>>
 class multiset {
  public:
   using key_type = Key;
@@ -16,19 +19,45 @@ class multiset {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using tree_type = BinaryTree::BinaryTree<key_type, Compare>;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = BinaryTree::BinaryTree<key_type, Compare, Allocator>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
+  using node_type = typename tree_type::node_type;
 
   multiset() : tree_() {}
-  explicit multiset(std::initializer_list<value_type> const &items) : tree_() {
-    for (const auto &item : items) tree_.insert_with_repetitions(item);
+  explicit multiset(const allocator_type &alloc) : tree_(alloc) {}
+  explicit multiset(const Compare &comp,
+                    const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit multiset(std::initializer_list<value_type> const &items,
+                    const allocator_type &alloc = allocator_type())
+      : multiset(items, Compare(), alloc) {}
+  multiset(std::initializer_list<value_type> const &items, const Compare &comp,
+           const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(items.begin(), items.end(), false);
   }
+  template <class InputIt>
+  multiset(InputIt first, InputIt last,
+           const allocator_type &alloc = allocator_type())
+      : multiset(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  multiset(InputIt first, InputIt last, const Compare &comp,
+           const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, false);
+  }  // O(n) for sorted input, unsorted input is sorted first
   multiset(const multiset &ms) : tree_(ms.tree_) {}
-  multiset(multiset &&ms) noexcept : tree_(std::move(ms.tree_)) {}
-  ~multiset() { clear(); }
+  multiset(multiset &&ms) noexcept(
+      std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(ms.tree_)) {}
+  ~multiset() = default;
 
-  multiset &operator=(multiset &&ms) &noexcept {
+  multiset &operator=(multiset &&ms) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
     if (this == &ms) return *this;
     tree_ = std::move(ms.tree_);
     return *this;
@@ -45,6 +74,16 @@ class multiset {
   const_iterator end() const { return tree_.end(); }
 
   void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static multiset from_sorted(InputIt first, InputIt last) {
+    multiset result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, false);
+  }  // replaces the contents, builds a balanced tree in one pass
   iterator insert(const value_type &key) {
     return tree_.insert_with_repetitions(key);
   }
@@ -55,10 +94,12 @@ class multiset {
     return results;
   }
   void erase(iterator pos) noexcept { tree_.erase(pos); }
-  void swap(multiset &other) noexcept { std::swap(tree_, other.tree_); }
-  void merge(multiset &other) {
-    for (const auto &item : other) insert(item);
-    other.clear();
+  void swap(multiset &other) noexcept { tree_.swap(other.tree_); }
+  void merge(multiset &other) { tree_.merge_with_repetitions(other.tree_); }
+  node_type extract(iterator pos) noexcept { return tree_.extract(pos); }
+  node_type extract(const Key &key) { return tree_.extract(key); }
+  iterator insert(node_type &&handle) {
+    return tree_.insert_with_repetitions(std::move(handle));
   }
 
   [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
@@ -69,6 +110,27 @@ class multiset {
   iterator find(const Key &key) noexcept { return tree_.find(key); }
   const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
   bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  size_type count(const K &key) const noexcept {
+    return tree_.count(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
   std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
     return tree_.equal_range(key);
   }
@@ -89,6 +151,15 @@ class multiset {
     return tree_.upper_bound(key);
   }
 
+  iterator nth_element(size_type k) noexcept { return tree_.nth_element(k); }
+  const_iterator nth_element(size_type k) const noexcept {
+    return tree_.nth_element(k);
+  }
+  size_type rank(const Key &key) const noexcept { return tree_.rank(key); }
+  size_type count_range(const Key &lo, const Key &hi) const noexcept {
+    return tree_.count_range(lo, hi);
+  }  // O(log n) order statistics, see BinaryTree
+
  private:
   tree_type tree_;
 };
@@ -5,10 +5,13 @@
 #ifndef CPP2_S21_CONTAINERS_1_S21_SET_H
 #define CPP2_S21_CONTAINERS_1_S21_SET_H
 
+#include <vector>
+
 #include "BinaryTree.h"
 
 namespace s21 {
-template <class Key, class Compare = std::less<Key>>
+template <class Key, class Compare = std::less<Key>,
+          class Allocator = PoolAllocator<Key>>
 class set {
  public:
   using key_type = Key;
@@ -16,15 +19,40 @@ class set {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
-  using tree_type = BinaryTree::BinaryTree<key_type, Compare>;
+  using allocator_type = Allocator;
+  using key_compare = Compare;
+  using value_compare = Compare;
+  using tree_type = BinaryTree::BinaryTree<key_type, Compare, Allocator>;
   using iterator = typename tree_type::iterator;
   using const_iterator = typename tree_type::const_iterator;
+  using node_type = typename tree_type::node_type;
+  using insert_return_type = typename tree_type::insert_return_type;
 
   set() : tree_() {}
-  explicit set(std::initializer_list<value_type> const &items) : tree_(items) {}
+  explicit set(const allocator_type &alloc) : tree_(alloc) {}
+  explicit set(const Compare &comp,
+               const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {}
+  explicit set(std::initializer_list<value_type> const &items,
+               const allocator_type &alloc = allocator_type())
+      : tree_(items, alloc) {}
+  set(std::initializer_list<value_type> const &items, const Compare &comp,
+      const allocator_type &alloc = allocator_type())
+      : tree_(items, comp, alloc) {}
+  template <class InputIt>
+  set(InputIt first, InputIt last,
+      const allocator_type &alloc = allocator_type())
+      : set(first, last, Compare(), alloc) {}
+  template <class InputIt>
+  set(InputIt first, InputIt last, const Compare &comp,
+      const allocator_type &alloc = allocator_type())
+      : tree_(comp, alloc) {
+    tree_.assign_sorted(first, last, true);
+  }  // O(n) for sorted input, unsorted input is sorted first
   set(const set &s) : tree_(s.tree_) {}
-  set(set &&s) noexcept : tree_(std::move(s.tree_)) {}
-  ~set() { clear(); }
+  set(set &&s) noexcept(std::is_nothrow_move_constructible_v<tree_type>)
+      : tree_(std::move(s.tree_)) {}
+  ~set() = default;
 
   iterator begin() { return tree_.begin(); }
   const_iterator begin() const { return tree_.begin(); }
@@ -35,7 +63,20 @@ class set {
   [[nodiscard]] size_type size() const noexcept { return tree_.size(); }
   [[nodiscard]] size_type max_size() const noexcept { return tree_.max_size(); }
 
+  key_compare key_comp() const { return tree_.key_comp(); }
+  value_compare value_comp() const { return tree_.key_comp(); }
+
   void clear() noexcept { tree_.clear(); }
+  template <class InputIt>
+  static set from_sorted(InputIt first, InputIt last) {
+    set result;
+    result.assign_sorted(first, last);
+    return result;
+  }
+  template <class InputIt>
+  void assign_sorted(InputIt first, InputIt last) {
+    tree_.assign_sorted(first, last, true);
+  }  // replaces the contents, builds a balanced tree in one pass
   std::pair<iterator, bool> insert(const value_type &value) {
     return tree_.insert(value);
   }
@@ -46,14 +87,66 @@ class set {
     return results;
   }
   void erase(iterator pos) noexcept { tree_.erase(pos); }
-  void swap(set &other) noexcept { std::swap(tree_, other.tree_); }
+  void swap(set &other) noexcept { tree_.swap(other.tree_); }
   void merge(set &other) { tree_.merge(other.tree_); }
+  node_type extract(iterator pos) noexcept { return tree_.extract(pos); }
+  node_type extract(const Key &key) { return tree_.extract(key); }
+  insert_return_type insert(node_type &&handle) {
+    return tree_.insert(std::move(handle));
+  }
 
   iterator find(const Key &key) noexcept { return tree_.find(key); }
   const_iterator find(const Key &key) const noexcept { return tree_.find(key); }
   bool contains(const Key &key) const noexcept { return tree_.contains(key); }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  iterator find(const K &key) noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return tree_.find(key);
+  }
+  template <class K, class C = Compare, class = typename C::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return tree_.contains(key);
+  }  // heterogeneous lookup, only with a transparent Compare
+
+  size_type count(const Key &key) const noexcept { return tree_.count(key); }
+  std::pair<iterator, iterator> equal_range(const Key &key) noexcept {
+    return tree_.equal_range(key);
+  }
+  std::pair<const_iterator, const_iterator> equal_range(
+      const Key &key) const noexcept {
+    return tree_.equal_range(key);
+  }
+  iterator lower_bound(const Key &key) noexcept {
+    return tree_.lower_bound(key);
+  }
+  const_iterator lower_bound(const Key &key) const noexcept {
+    return tree_.lower_bound(key);
+  }
+  iterator upper_bound(const Key &key) noexcept {
+    return tree_.upper_bound(key);
+  }
+  const_iterator upper_bound(const Key &key) const noexcept {
+    return tree_.upper_bound(key);
+  }
+
+  iterator nth_element(size_type k) noexcept { return tree_.nth_element(k); }
+  const_iterator nth_element(size_type k) const noexcept {
+    return tree_.nth_element(k);
+  }
+  size_type rank(const Key &key) const noexcept { return tree_.rank(key); }
+  size_type count_range(const Key &lo, const Key &hi) const noexcept {
+    return tree_.count_range(lo, hi);
+  }  // O(log n) order statistics, see BinaryTree
+
+  allocator_type get_allocator() const noexcept {
+    return tree_.get_allocator();
+  }
 
-  set &operator=(set &&s) &noexcept {
+  set &operator=(set &&s) &noexcept(
+      std::is_nothrow_move_assignable_v<tree_type>) {
     if (this == &s) return *this;
     tree_ = std::move(s.tree_);
     return *this;
@@ -0,0 +1,163 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+
+#include <tuple>
+
+#include "HashTable.h"
+
+namespace s21 {
+// Hash map with open addressing, see unordered_set. Entries live in the
+// table itself and move when it grows or when a neighbour is inserted or
+// erased, so any insert or erase invalidates iterators and references.
+template <class Key, class T, class Hash = std::hash<Key>,
+          class KeyEqual = std::equal_to<Key>,
+          class Allocator = std::allocator<std::pair<const Key, T>>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using table_type = HashTable::HashTable<value_type, Hash, KeyEqual, Allocator,
+                                          BinaryTree::SelectFirst>;
+  using iterator = typename table_type::iterator;
+  using const_iterator = typename table_type::const_iterator;
+
+  unordered_map() : table_() {}
+  explicit unordered_map(const allocator_type &alloc) : table_(alloc) {}
+  explicit unordered_map(size_type buckets, const Hash &hash = Hash(),
+                         const KeyEqual &equal = KeyEqual(),
+                         const allocator_type &alloc = allocator_type())
+      : table_(buckets, hash, equal, alloc) {}
+  explicit unordered_map(std::initializer_list<value_type> const &items,
+                         const allocator_type &alloc = allocator_type())
+      : table_(alloc) {
+    insert(items.begin(), items.end());
+  }
+  template <class InputIt>
+  unordered_map(InputIt first, InputIt last,
+                const allocator_type &alloc = allocator_type())
+      : table_(alloc) {
+    insert(first, last);
+  }
+  unordered_map(const unordered_map &m) : table_(m.table_) {}
+  unordered_map(unordered_map &&m) noexcept(
+      std::is_nothrow_move_constructible_v<table_type>)
+      : table_(std::move(m.table_)) {}
+  ~unordered_map() = default;
+
+  unordered_map &operator=(unordered_map &&m) &noexcept(
+      std::is_nothrow_move_assignable_v<table_type>) {
+    if (this == &m) return *this;
+    table_ = std::move(m.table_);
+    return *this;
+  }
+  unordered_map &operator=(const unordered_map &m) & {
+    if (this == &m) return *this;
+    table_ = m.table_;
+    return *this;
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return table_.emplace_unique(value.first, value);
+  }
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return table_.emplace_unique(value.first, std::move(value));
+  }
+  std::pair<iterator, bool> insert(const Key &key, const T &obj) {
+    return table_.emplace_unique(key, key, obj);
+  }
+  template <class InputIt>
+  void insert(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (std::is_base_of_v<std::forward_iterator_tag, category>)
+      reserve(size() + std::distance(first, last));
+    for (; first != last; ++first) insert(*first);
+  }  // sizes the table once for forward ranges
+  std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj) {
+    auto result = table_.emplace_unique(key, key, obj);
+    if (!result.second) result.first->second = obj;
+    return result;
+  }
+  template <typename... Args>
+  void insert_many(Args &&...args) {
+    reserve(size() + sizeof...(Args));
+    (insert(std::forward<Args>(args)), ...);
+  }  // iterators from earlier inserts would not survive later ones
+
+  void swap(unordered_map &other) noexcept { table_.swap(other.table_); }
+  void merge(unordered_map &other) { table_.merge(other.table_); }
+
+  iterator begin() noexcept { return table_.begin(); }
+  const_iterator begin() const noexcept { return table_.begin(); }
+  iterator end() noexcept { return table_.end(); }
+  const_iterator end() const noexcept { return table_.end(); }
+  iterator erase(const_iterator pos) { return table_.erase(pos); }
+  size_type erase(const Key &key) { return table_.erase_key(key); }
+  T &at(const Key &key) & { return table_.at(key).second; }
+  const T &at(const Key &key) const & { return table_.at(key).second; }
+  T &operator[](const Key &key) & {
+    return table_
+        .emplace_unique(key, std::piecewise_construct,
+                        std::forward_as_tuple(key), std::forward_as_tuple())
+        .first->second;
+  }  // the mapped value is default-constructed only when key is missing
+
+  iterator find(const Key &key) noexcept { return table_.find(key); }
+  const_iterator find(const Key &key) const noexcept {
+    return table_.find(key);
+  }
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  iterator find(const K &key) noexcept {
+    return table_.find(key);
+  }
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  const_iterator find(const K &key) const noexcept {
+    return table_.find(key);
+  }  // heterogeneous lookup, only with a transparent Hash and KeyEqual
+  bool contains(const Key &key) const noexcept { return table_.contains(key); }
+  template <class K, class H = Hash, class E = KeyEqual,
+            class = typename H::is_transparent,
+            class = typename E::is_transparent>
+  bool contains(const K &key) const noexcept {
+    return table_.contains(key);
+  }
+  size_type count(const Key &key) const noexcept {
+    return table_.contains(key) ? 1 : 0;
+  }
+
+  void clear() noexcept { table_.clear(); }
+  [[nodiscard]] bool empty() const noexcept { return table_.empty(); }
+  [[nodiscard]] size_type size() const noexcept { return table_.size(); }
+  [[nodiscard]] size_type max_size() const noexcept {
+    return table_.max_size();
+  }
+
+  size_type bucket_count() const noexcept { return table_.bucket_count(); }
+  float load_factor() const noexcept { return table_.load_factor(); }
+  float max_load_factor() const noexcept { return table_.max_load_factor(); }
+  void max_load_factor(float ml) { table_.max_load_factor(ml); }
+  void rehash(size_type buckets) { table_.rehash(buckets); }
+  void reserve(size_type n) { table_.reserve(n); }
+
+  hasher hash_function() const { return table_.hash_function(); }
+  key_equal key_eq() const { return table_.key_eq(); }
+  allocator_type get_allocator() const noexcept {
+    return table_.get_allocator();
+  }
+
+ private:
+  table_type table_;
+};
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
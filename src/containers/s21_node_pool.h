@@ -0,0 +1,320 @@
+#ifndef CONTAINERS_NODE_POOL_H
+#define CONTAINERS_NODE_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+// Slab allocator for fixed-size nodes. Slots are carved out of blocks that
+// are aligned to their own size, so a slot finds its block by masking its
+// address. A block belongs to the thread that created it: that thread
+// allocates from it and frees into it without a lock and counts its live
+// slots. Any other thread hands a slot back by pushing it onto the block's
+// remote list, which the owner drains when its current block runs dry. A
+// block whose slots are all free again returns to the heap, one spare per
+// thread aside, so the memory held follows the live node count even when
+// one thread allocates and another frees. The blocks of an exited thread
+// are orphaned and the last release into each of them frees it.
+template <size_t Size, size_t Align>
+class NodePool {
+ public:
+  static void *Allocate() {
+    if (Dead()) {
+      Shared &shared = Global();
+      std::lock_guard<std::mutex> lock(shared.mutex_);
+      return shared.cache_.Allocate();
+    }  // slow path for threads whose cache is already gone
+    return Local().Allocate();
+  }
+
+  static void Deallocate(void *p) noexcept {
+    if (p == nullptr) return;
+    Slot *slot = static_cast<Slot *>(p);
+    Block *block = BlockOf(slot);
+    if (!Dead()) {
+      Cache &cache = Local();
+      if (block->owner_ == cache.id_) return cache.Release(block, slot);
+    }
+    ReleaseRemote(block, slot);
+  }
+
+  // Blocks currently taken from the heap by all threads together.
+  static size_t Blocks() noexcept {
+    return Global().blocks_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Align) unsigned char bytes[Size];
+  };
+
+  // Sits at the start of every block. remote_ is written by other threads
+  // and has a cache line of its own; the rest belongs to the owner, or to
+  // whoever holds the global mutex once the block is orphaned.
+  struct Block {
+    alignas(64) std::atomic<Slot *> remote_{nullptr};
+    alignas(64) unsigned long owner_ = 0;
+    Block *prev_ = nullptr;
+    Block *next_ = nullptr;
+    Block *next_ready_ = nullptr;
+    Slot *free_ = nullptr;
+    Slot *bump_ = nullptr;
+    size_t live_ = 0;  // slots handed out and not yet drained back
+    bool ready_ = false;
+  };
+
+  static constexpr size_t kHeaderBytes =
+      (sizeof(Block) + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+
+  static constexpr size_t BlockBytes() {
+    size_t bytes = 256 * 1024;
+    while (bytes < kHeaderBytes + 32 * sizeof(Slot)) bytes *= 2;
+    return bytes;
+  }  // a power of two holding at least 32 slots
+
+  static constexpr size_t kBlockBytes = BlockBytes();
+  static constexpr size_t kSlots = (kBlockBytes - kHeaderBytes) / sizeof(Slot);
+
+  struct Cache {
+    unsigned long id_ = NextId();
+    Block *blocks_ = nullptr;   // every block owned, doubly linked
+    Block *current_ = nullptr;  // the block allocations come from
+    Block *ready_ = nullptr;    // blocks with free slots, linked by next_ready_
+    Block *spare_ = nullptr;    // an empty block kept back from the heap
+
+    void *Allocate() {
+      if (current_ != nullptr) {
+        if (Slot *slot = Take(current_)) return slot;
+      }
+      if (ready_ == nullptr) Scan();
+      Block *block = ready_;
+      if (block != nullptr) {
+        ready_ = block->next_ready_;
+        block->ready_ = false;
+      } else {
+        block = Adopt();
+      }
+      current_ = block;
+      return Take(block);
+    }
+
+    void Release(Block *block, Slot *slot) noexcept {
+      Push(block->free_, slot);
+      if (--block->live_ == 0 && block != current_ && !block->ready_)
+        Retire(block);
+    }
+
+    // Drains every block but the current one, retires those that turn out
+    // empty and queues those with free slots.
+    void Scan() noexcept {
+      for (Block *block = blocks_, *next = nullptr; block != nullptr;
+           block = next) {
+        next = block->next_;
+        if (block == current_) continue;
+        Drain(block);
+        if (block->live_ == 0) {
+          Retire(block);
+        } else if (block->free_ != nullptr) {
+          block->ready_ = true;
+          block->next_ready_ = ready_;
+          ready_ = block;
+        }
+      }
+    }
+
+    Block *Adopt() {
+      Block *block = spare_;
+      if (block != nullptr) {
+        spare_ = nullptr;
+      } else {
+        block = NewBlock(id_);
+      }
+      block->free_ = nullptr;
+      block->bump_ = First(block);
+      block->live_ = 0;
+      block->prev_ = nullptr;
+      block->next_ = blocks_;
+      if (blocks_ != nullptr) blocks_->prev_ = block;
+      blocks_ = block;
+      return block;
+    }  // takes the spare or a new block and links it in
+
+    void Retire(Block *block) noexcept {
+      if (block->prev_ != nullptr) {
+        block->prev_->next_ = block->next_;
+      } else {
+        blocks_ = block->next_;
+      }
+      if (block->next_ != nullptr) block->next_->prev_ = block->prev_;
+      if (spare_ == nullptr) {
+        spare_ = block;
+      } else {
+        DeleteBlock(block);
+      }
+    }
+
+    ~Cache() {
+      if (spare_ != nullptr) DeleteBlock(spare_);
+      Shared &shared = Global();
+      std::lock_guard<std::mutex> lock(shared.mutex_);
+      while (blocks_ != nullptr) {
+        Block *block = blocks_;
+        blocks_ = block->next_;
+        Slot *slot = block->remote_.exchange(Orphaned(),
+                                             std::memory_order_acquire);
+        for (; slot != nullptr; slot = slot->next) --block->live_;
+        if (block->live_ == 0) DeleteBlock(block);
+      }
+      Dead() = true;
+    }  // later releases into the orphans go through the mutex
+  };
+
+  struct Shared {
+    std::mutex mutex_;
+    Cache cache_;  // serves threads whose own cache is gone
+    std::atomic<size_t> blocks_{0};
+  };
+
+  static Shared &Global() {
+    static Shared *shared = new Shared;
+    return *shared;
+  }  // never destroyed, containers with static storage may outlive it
+
+  static Cache &Local() {
+    thread_local Cache cache;
+    return cache;
+  }
+
+  static bool &Dead() {
+    thread_local bool dead = false;
+    return dead;
+  }  // trivially destructible, still readable while the thread tears down
+
+  static unsigned long NextId() noexcept {
+    static std::atomic<unsigned long> next{1};
+    return next.fetch_add(1, std::memory_order_relaxed);
+  }  // never reused, unlike the address of an exited thread's cache
+
+  static Slot *Orphaned() noexcept {
+    static Slot marker;
+    return &marker;
+  }  // remote_ of a block whose owner has exited
+
+  static void Push(Slot *&list, Slot *slot) noexcept {
+    slot->next = list;
+    list = slot;
+  }
+
+  static Slot *First(Block *block) noexcept {
+    return reinterpret_cast<Slot *>(reinterpret_cast<unsigned char *>(block) +
+                                    kHeaderBytes);
+  }
+
+  static Block *BlockOf(Slot *slot) noexcept {
+    return reinterpret_cast<Block *>(reinterpret_cast<std::uintptr_t>(slot) &
+                                     ~std::uintptr_t{kBlockBytes - 1});
+  }
+
+  static Slot *Take(Block *block) noexcept {
+    if (block->free_ == nullptr) {
+      if (block->bump_ != First(block) + kSlots) {
+        ++block->live_;
+        return block->bump_++;
+      }
+      Drain(block);
+      if (block->free_ == nullptr) return nullptr;
+    }
+    Slot *slot = block->free_;
+    block->free_ = slot->next;
+    ++block->live_;
+    return slot;
+  }
+
+  // Moves the slots other threads released into the owner's free list.
+  static void Drain(Block *block) noexcept {
+    Slot *slot = block->remote_.exchange(nullptr, std::memory_order_acquire);
+    while (slot != nullptr) {
+      Slot *next = slot->next;
+      Push(block->free_, slot);
+      --block->live_;
+      slot = next;
+    }
+  }
+
+  static void ReleaseRemote(Block *block, Slot *slot) noexcept {
+    Slot *head = block->remote_.load(std::memory_order_relaxed);
+    do {
+      if (head == Orphaned()) {
+        std::lock_guard<std::mutex> lock(Global().mutex_);
+        if (--block->live_ == 0) DeleteBlock(block);
+        return;
+      }
+      slot->next = head;
+    } while (!block->remote_.compare_exchange_weak(
+        head, slot, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  static Block *NewBlock(unsigned long owner) {
+    void *raw = ::operator new(kBlockBytes, std::align_val_t(kBlockBytes));
+    Block *block = ::new (raw) Block;
+    block->owner_ = owner;
+    Global().blocks_.fetch_add(1, std::memory_order_relaxed);
+    return block;
+  }
+
+  static void DeleteBlock(Block *block) noexcept {
+    block->~Block();
+    ::operator delete(block, std::align_val_t(kBlockBytes));
+    Global().blocks_.fetch_sub(1, std::memory_order_relaxed);
+  }
+};
+
+// Stateless allocator that serves single objects from the matching NodePool
+// and falls back to the global heap for arrays. Node-based containers rebind
+// it to their node type, so every node comes from a pool sized for it.
+template <typename T>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  PoolAllocator() noexcept = default;
+
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U> &) noexcept {}  // NOLINT
+
+  T *allocate(size_t n) {
+    if (n == 1) return static_cast<T *>(pool::Allocate());
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, size_t n) noexcept {
+    if (n == 1)
+      pool::Deallocate(p);
+    else
+      std::allocator<T>().deallocate(p, n);
+  }
+
+ private:
+  using pool = NodePool<sizeof(T), alignof(T)>;
+};
+
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T> &, const PoolAllocator<U> &) noexcept {
+  return false;
+}
+}  // namespace s21
+
+#endif  // CONTAINERS_NODE_POOL_H
@@ -4,10 +4,15 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <utility>
+
+#include "../s21_node_pool.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 class List {
  public:
   class ListIterator;
@@ -18,57 +23,99 @@ class List {
   using size_type = size_t;
   using iterator = ListIterator;
   using const_iterator = ListIteratorConst;
+  using allocator_type = Allocator;
+
+  List() : List(allocator_type()) {}  // constructor
 
-  List()
+  explicit List(const allocator_type &alloc)
       : l_size_(0U),
         begin_(nullptr),
         end_(nullptr),
-        fake_(nullptr) {  // constructor
-    fake_ = new Node;
+        fake_(nullptr),
+        node_alloc_(alloc) {  // constructor with a node source
+    fake_ = Create_Sentinel();
   }
 
-  explicit List(size_type n) : List() {  // parameterized constructor
+  explicit List(size_type n, const allocator_type &alloc = allocator_type())
+      : List(alloc) {  // parameterized constructor
     while (n > 0) {
-      Push_Back(value_type());
+      Emplace_Back();
       --n;
     }
   }
 
-  explicit List(std::initializer_list<value_type> const &items)
-      : List() {  // initializer list constructor, creates list initizialized
-                  // using std::initializer_list
+  explicit List(std::initializer_list<value_type> const &items,
+                const allocator_type &alloc = allocator_type())
+      : List(alloc) {  // initializer list constructor, creates list
+                       // initizialized using std::initializer_list
     for (const auto &item : items) {
       Push_Back(item);
     }
   }
 
-  List(const List &l) : List() {  // copy constructor
+  List(const List &l)
+      : List(node_traits::select_on_container_copy_construction(
+            l.node_alloc_)) {  // copy constructor
     Copy(l);
   }
 
-  List(List &&l) noexcept : List() {  // move constructor
-    l_size_ = l.l_size_;
-    Swap(l);
-  }
+  List(List &&l) noexcept
+      : l_size_(l.l_size_),
+        begin_(l.begin_),
+        end_(l.end_),
+        fake_(l.fake_),
+        node_alloc_(l.node_alloc_) {  // move constructor, takes the sentinel
+    l.l_size_ = 0;
+    l.begin_ = nullptr;
+    l.end_ = nullptr;
+    l.fake_ = nullptr;
+  }  // l gets a new sentinel on its next insertion
 
   ~List() {
     Clear();
-    delete fake_;
+    Free_Node(fake_);
     fake_ = nullptr;
   }  // destructor
 
   List &operator=(List const &l) {
+    if (this == &l) return *this;
     Clear();
+    if constexpr (node_traits::propagate_on_container_copy_assignment::
+                      value) {
+      if (node_alloc_ != l.node_alloc_) {
+        Free_Node(fake_);
+        fake_ = nullptr;
+        node_alloc_ = l.node_alloc_;
+        fake_ = Create_Sentinel();
+      }
+    }
     Copy(l);
     return *this;
   }  // operator copy
 
-  List &operator=(List &&l) noexcept {
-    l_size_ = l.l_size_;
-    Swap(l);
+  List &operator=(List &&l) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
+    if (this == &l) return *this;
+    if constexpr (node_traits::propagate_on_container_move_assignment::
+                      value) {
+      Swap_Nodes(l);
+      std::swap(node_alloc_, l.node_alloc_);
+    } else if (node_alloc_ == l.node_alloc_) {
+      Swap_Nodes(l);
+    } else {
+      Clear();
+      for (Node *cur = l.begin_; cur != nullptr && cur != l.fake_;
+           cur = cur->next) {
+        Emplace_Back(std::move(cur->data));
+      }
+      l.Clear();
+    }
     return *this;
   }
 
+  allocator_type Get_Allocator() const { return allocator_type(node_alloc_); }
+
   const_reference Front() const { return begin_->data; }
 
   const_reference Back() const { return end_->data; }
@@ -101,7 +148,7 @@ class List {
     if (!Empty()) {
       while (begin_ != fake_) {
         end_ = begin_->next;
-        delete begin_;
+        Destroy_Node(begin_);
         begin_ = end_;
         --l_size_;
       }
@@ -109,49 +156,34 @@ class List {
       fake_->prev = nullptr;
       begin_ = nullptr;
       end_ = nullptr;
-      delete fake_;
-      fake_ = nullptr;
       l_size_ = 0;
     }
-  }
+  }  // the sentinel node is kept, so End() stays valid
 
   iterator Insert(iterator idx, value_type value) {
-    bool out = false;
-    iterator it_b = Begin();
-    for (; it_b != End(); ++it_b) {
-      if (it_b == idx) {
-        out = false;
-        break;
-      }
-      out = true;
-    }
-    if (idx == Begin()) {
-      Push_Front(value);
-      idx = iterator(begin_);
-    } else if (out) {
-      Push_Back(value);
-      idx = iterator(end_);
-    } else {
-      Node *newNode = new Node(value);
-      Node *tmp = begin_;
-      Node *tmp2 = tmp->next;
-      iterator it = Begin();
-      --idx;
-      for (; it != idx; ++it) {
-        tmp = tmp->next;
-        tmp2 = tmp2->next;
-      }
-      newNode->next = tmp->next;
-      newNode->prev = tmp;
-      tmp->next = newNode;
-      tmp2->prev = newNode;
-      ++it;
-      ++l_size_;
-      return it;
-    }
-    return idx;
+    return Emplace(const_iterator(idx.cur), std::move(value));
   }  // вставить в позицию
 
+  template <typename... Args>
+  iterator Emplace(const_iterator pos, Args &&...args) {
+    Node *next = pos.cur;
+    if (Empty() || next == nullptr || next == fake_) {
+      Emplace_Back(std::forward<Args>(args)...);
+      return iterator(end_);
+    }
+    if (next == begin_) {
+      Emplace_Front(std::forward<Args>(args)...);
+      return iterator(begin_);
+    }
+    Node *newNode = Create_Node(std::forward<Args>(args)...);
+    newNode->prev = next->prev;
+    newNode->next = next;
+    next->prev->next = newNode;
+    next->prev = newNode;
+    ++l_size_;
+    return iterator(newNode);
+  }  // сконструировать элемент на месте перед pos
+
   void Erase(iterator idx) {
     if (l_size_ == 0) return;
     Node *delEl;
@@ -165,52 +197,63 @@ class List {
     }
     Node *prev = delEl->prev;
     Node *next = delEl->next;
-    delete delEl;
-    if ((l_size_ > 1) && (prev != nullptr)) {
+    if (delEl == begin_) {
+      begin_ = (l_size_ > 1) ? next : nullptr;
+    } else {
       prev->next = next;
     }
-    if ((next != fake_) && (l_size_ > 1)) {
+    if (delEl == end_) {
+      end_ = (l_size_ > 1) ? prev : nullptr;
+    } else {
       next->prev = prev;
     }
-    if (idx == Begin()) {
-      begin_ = next;
-    }
-    if (idx == End()) {
-      end_ = prev;
+    if (fake_ != nullptr) {
+      fake_->prev = end_;
+      fake_->next = begin_;
     }
+    Destroy_Node(delEl);
     --l_size_;
   }  // удалить по индексу
 
-  void Push_Back(value_type value) {
-    try {
-      Node *tmp = new Node;
-      tmp->next = nullptr;
-      tmp->prev = end_;
-      tmp->data = value;
-      if (end_ != nullptr) {
-        end_->next = tmp;
-      }
-      if (l_size_ == 0) {
-        begin_ = end_ = tmp;
-      } else {
-        end_ = tmp;
-      }
-      end_->next = fake_;
+  void Push_Back(const_reference value) { Emplace_Back(value); }  // add end
+
+  void Push_Back(value_type &&value) { Emplace_Back(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace_Back(Args &&...args) {
+    if (fake_ == nullptr) fake_ = Create_Sentinel();
+    Node *tmp = Create_Node(std::forward<Args>(args)...);
+    tmp->next = nullptr;
+    tmp->prev = end_;
+    if (end_ != nullptr) {
+      end_->next = tmp;
+    }
+    if (l_size_ == 0) {
+      begin_ = end_ = tmp;
+    } else {
+      end_ = tmp;
+    }
+    end_->next = fake_;
+    if (fake_ != nullptr) {
       fake_->prev = end_;
       fake_->next = begin_;
-      ++l_size_;
-    } catch (std::bad_alloc &err) {
-      std::cout << err.what() << std::endl;
     }
-  }  // add end
+    ++l_size_;
+    return tmp->data;
+  }  // сконструировать элемент в конце
 
   void Pop_Back() { Erase(End()); }
 
-  void Push_Front(value_type value) {
-    Node *tmp = new Node;
+  void Push_Front(const_reference value) { Emplace_Front(value); }  // add begin
+
+  void Push_Front(value_type &&value) { Emplace_Front(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace_Front(Args &&...args) {
+    if (fake_ == nullptr) fake_ = Create_Sentinel();
+    Node *tmp = Create_Node(std::forward<Args>(args)...);
     tmp->next = begin_;
     tmp->prev = nullptr;
-    tmp->data = value;
     if (l_size_ > 0) {
       begin_->prev = tmp;
       begin_ = tmp;
@@ -218,19 +261,22 @@ class List {
       begin_ = end_ = tmp;
     }
     end_->next = fake_;
-    fake_->prev = end_;
-    fake_->next = begin_;
+    if (fake_ != nullptr) {
+      fake_->prev = end_;
+      fake_->next = begin_;
+    }
     ++l_size_;
-  }  // add begin
+    return tmp->data;
+  }  // сконструировать элемент в начале
 
   void Pop_Front() { Erase(Begin()); }
 
   void Swap(List &other) {
     if (this != &other) {
-      std::swap(begin_, other.begin_);
-      std::swap(end_, other.end_);
-      std::swap(fake_, other.fake_);
-      std::swap(l_size_, other.l_size_);
+      Swap_Nodes(other);
+      if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(node_alloc_, other.node_alloc_);
+      }
     }
   }
 
@@ -315,7 +361,7 @@ class List {
 
   void Swap_Elem(value_type &val1, value_type &val2) { std::swap(val1, val2); }
 
-  void Copy(const List<value_type> &obj) {
+  void Copy(const List &obj) {
     Clear();
     Node *tmp = obj.begin_;
     while (tmp != obj.fake_) {
@@ -326,18 +372,63 @@ class List {
 
  private:
   struct Node {
-    value_type data;
     Node *prev;  // end
     Node *next;  // begin
-    explicit Node(value_type value = value_type(), Node *prev = nullptr,
-                  Node *next = nullptr)
-        : data(value), prev(prev), next(next) {}
+    union {
+      value_type data;  // left unconstructed in the sentinel
+    };
+    Node() : prev(nullptr), next(nullptr) {}
+    ~Node() {}
   };
 
+  using value_traits = std::allocator_traits<allocator_type>;
+  using node_allocator = typename value_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  Node *Create_Sentinel() {
+    Node *node = node_traits::allocate(node_alloc_, 1);
+    return ::new (static_cast<void *>(node)) Node();
+  }
+
+  template <typename... Args>
+  Node *Create_Node(Args &&...args) {
+    Node *node = Create_Sentinel();
+    try {
+      allocator_type alloc(node_alloc_);
+      value_traits::construct(alloc, std::addressof(node->data),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      Free_Node(node);
+      throw;
+    }
+    return node;
+  }  // the element is built through the value allocator, so scoped
+     // allocators such as std::pmr reach it as well
+
+  void Destroy_Node(Node *node) noexcept {
+    allocator_type alloc(node_alloc_);
+    value_traits::destroy(alloc, std::addressof(node->data));
+    Free_Node(node);
+  }
+
+  void Free_Node(Node *node) noexcept {
+    if (node == nullptr) return;
+    node->~Node();
+    node_traits::deallocate(node_alloc_, node, 1);
+  }
+
+  void Swap_Nodes(List &other) noexcept {
+    std::swap(begin_, other.begin_);
+    std::swap(end_, other.end_);
+    std::swap(fake_, other.fake_);
+    std::swap(l_size_, other.l_size_);
+  }
+
   size_t l_size_;
   Node *begin_;
   Node *end_;
   Node *fake_;
+  node_allocator node_alloc_;
 
  public:
   class ListIterator {
@@ -385,6 +476,7 @@ class List {
     bool operator!=(const iterator &other) const { return cur != other.cur; }
 
    private:
+    friend class List;
     Node *cur;
   };
 
@@ -437,44 +529,25 @@ class List {
     }
 
    private:
+    friend class List;
     Node *cur;
   };
 
   // Bonus
   template <typename... Args>
   iterator Insert_Many(const_iterator pos, Args &&...args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    const_iterator it = Cbegin();
-    iterator new_pos = Begin();
-    while (it != pos) {
-      ++new_pos;
-      ++it;
-    }
-
-    for (auto const &i : args_v) {
-      new_pos = Insert((new_pos), i);
-      ++new_pos;
-    }
-    return new_pos;
+    (..., Emplace(pos, std::forward<Args>(args)));
+    return iterator(pos.cur);
   }
 
   template <typename... Args>
   void Insert_Many_Back(Args &&...args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    for (auto const &i : args_v) {
-      Push_Back(i);
-    }
+    (..., Emplace_Back(std::forward<Args>(args)));
   }
 
   template <typename... Args>
   void insert_many_front(Args &&...args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    for (auto const &i : args_v) {
-      Push_Front(i);
-    }
+    (..., Emplace_Front(std::forward<Args>(args)));
   }
 };
 }  // namespace s21
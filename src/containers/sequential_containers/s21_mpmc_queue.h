@@ -0,0 +1,275 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+// Bounded FIFO for any number of producer and consumer threads, after
+// Dmitry Vyukov's array queue. Every cell carries a sequence number that
+// says whose turn it is: a producer may fill cell pos & mask when the
+// sequence equals pos, a consumer may empty it when the sequence equals
+// pos + 1, and each hands the cell on by storing the next turn's number.
+// Threads claim positions with a compare-and-swap on the shared enqueue or
+// dequeue counter, each on its own cache line, so pushes and pops never
+// take a lock and only contend with their own kind.
+//
+// try_push and try_pop fail at once when the queue is full or empty. push
+// and pop wait instead: they spin briefly, then yield, then park on a
+// condition variable until an operation on the other side wakes them.
+template <typename T, typename Allocator = std::allocator<T>>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kCacheLine = 64;
+
+  static_assert(std::is_nothrow_move_constructible_v<T> ||
+                    std::is_nothrow_copy_constructible_v<T>,
+                "a claimed cell must be filled without throwing");
+
+  explicit mpmc_queue(size_type capacity,
+                      const allocator_type& alloc = allocator_type())
+      : shared(alloc, roundUp(capacity)) {
+    for (size_type i = 0; i <= shared.mask; ++i)
+      ::new (static_cast<void*>(shared.cells + i)) Cell(i);
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+  mpmc_queue& operator=(const mpmc_queue&) = delete;
+
+  ~mpmc_queue() {
+    const size_type end = enqueue.position.load(std::memory_order_relaxed);
+    for (size_type pos = dequeue.position.load(std::memory_order_relaxed);
+         pos != end; ++pos)
+      value_traits::destroy(shared.alloc, cellAt(pos)->value());
+    for (size_type i = 0; i <= shared.mask; ++i) shared.cells[i].~Cell();
+    cell_allocator cellAlloc(shared.alloc);
+    cell_traits::deallocate(cellAlloc, shared.cells, shared.mask + 1);
+  }
+
+  allocator_type get_allocator() const { return shared.alloc; }
+
+  size_type capacity() const noexcept { return shared.mask + 1; }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    const size_type head = dequeue.position.load(std::memory_order_acquire);
+    const size_type tail = enqueue.position.load(std::memory_order_acquire);
+    return tail > head ? std::min(tail - head, capacity()) : 0;
+  }  // a snapshot, other threads may change it at once
+
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+      size_type pos = 0;
+      Cell* cell = claim(enqueue.position, 0, pos);
+      if (cell == nullptr) return false;
+      value_traits::construct(shared.alloc, cell->value(),
+                              std::forward<Args>(args)...);
+      cell->sequence.store(pos + 1, std::memory_order_release);
+      wake(popParking);
+      return true;
+    } else if constexpr (std::is_nothrow_move_constructible_v<T>) {
+      return try_emplace(value_type(std::forward<Args>(args)...));
+    } else {
+      const value_type value(std::forward<Args>(args)...);
+      return try_emplace(value);
+    }
+  }  // a throwing constructor runs before a cell is claimed
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+  bool try_pop(reference out) {
+    size_type pos = 0;
+    Cell* cell = claim(dequeue.position, 1, pos);
+    if (cell == nullptr) return false;
+    try {
+      out = std::move(*cell->value());
+    } catch (...) {
+      release(cell, pos);
+      throw;
+    }
+    release(cell, pos);
+    return true;
+  }  // if moving into out throws, the value is dropped
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    if constexpr (std::is_nothrow_constructible_v<T, Args&&...>) {
+      wait(pushParking,
+           [&] { return try_emplace(std::forward<Args>(args)...); });
+    } else {
+      value_type value(std::forward<Args>(args)...);
+      wait(pushParking, [&] {
+        if constexpr (std::is_nothrow_move_constructible_v<T>) {
+          return try_emplace(std::move(value));
+        } else {
+          return try_emplace(std::as_const(value));
+        }
+      });
+    }
+  }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  void pop(reference out) {
+    wait(popParking, [&] { return try_pop(out); });
+  }
+
+ private:
+  using value_traits = std::allocator_traits<allocator_type>;
+
+  struct Cell {
+    explicit Cell(size_type initial) : sequence(initial) {}
+
+    T* value() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  using cell_allocator = typename value_traits::template rebind_alloc<Cell>;
+  using cell_traits = std::allocator_traits<cell_allocator>;
+
+  struct alignas(kCacheLine) Position {
+    std::atomic<size_type> position{0};
+  };
+
+  // Threads blocked in push or pop, and what they sleep on. epoch counts
+  // wakeups, guarded by mutex.
+  struct alignas(kCacheLine) Parking {
+    std::atomic<unsigned> waiters{0};
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    unsigned long epoch = 0;
+  };
+
+  // Written once by the constructor and only read afterwards.
+  struct alignas(kCacheLine) Shared {
+    Shared(const allocator_type& allocator, size_type cellCount)
+        : alloc(allocator), cells(allocate(alloc, cellCount)),
+          mask(cellCount - 1) {}
+
+    static Cell* allocate(const allocator_type& allocator, size_type count) {
+      cell_allocator cellAlloc(allocator);
+      return cell_traits::allocate(cellAlloc, count);
+    }
+
+    allocator_type alloc;
+    Cell* cells;
+    size_type mask;
+  };
+
+  static size_type roundUp(size_type capacity) {
+    if (capacity == 0 || capacity > (SIZE_MAX >> 2) + 1)
+      throw std::length_error("mpmc_queue capacity out of range");
+    size_type cells = 2;
+    while (cells < capacity) cells <<= 1;
+    return cells;
+  }
+
+  Cell* cellAt(size_type pos) const noexcept {
+    return shared.cells + (pos & shared.mask);
+  }
+
+  // Claims the cell at the counter's next position pos, for a producer when
+  // offset is 0 and a consumer when it is 1. Returns nullptr if the cell
+  // is not ready, that is the queue is full or empty.
+  Cell* claim(std::atomic<size_type>& counter, size_type offset,
+              size_type& pos) noexcept {
+    pos = counter.load(std::memory_order_relaxed);
+    for (;;) {
+      Cell* cell = cellAt(pos);
+      const size_type sequence = cell->sequence.load(std::memory_order_acquire);
+      const auto lag = static_cast<std::ptrdiff_t>(sequence - (pos + offset));
+      if (lag == 0) {
+        if (counter.compare_exchange_weak(pos, pos + 1,
+                                          std::memory_order_relaxed))
+          return cell;
+      } else if (lag < 0) {
+        return nullptr;
+      } else {
+        pos = counter.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  // Destroys a popped value and hands its cell to the producer one lap on.
+  void release(Cell* cell, size_type pos) noexcept {
+    value_traits::destroy(shared.alloc, cell->value());
+    cell->sequence.store(pos + shared.mask + 1, std::memory_order_release);
+    wake(pushParking);
+  }
+
+  // Retries op with growing backoff, then parks between attempts. A waiter
+  // registers before its attempts and a waker checks for waiters after its
+  // change, with a fence on each side, so one of them sees the other. The
+  // epoch is read before each attempt, so a wakeup that lands between a
+  // failed attempt and the wait is not lost. op must not hold the mutex.
+  template <typename Op>
+  void wait(Parking& parking, Op op) {
+    for (unsigned spins = 0; spins < 80; ++spins) {
+      if (op()) return;
+      if (spins < 64) {
+#if defined(__SSE2__)
+        _mm_pause();
+#endif
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    parking.waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (;;) {
+      std::unique_lock<std::mutex> lock(parking.mutex);
+      const unsigned long epoch = parking.epoch;
+      lock.unlock();
+      if (op()) break;
+      lock.lock();
+      parking.wakeup.wait(lock, [&] { return parking.epoch != epoch; });
+    }
+    parking.waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  static void wake(Parking& parking) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parking.waiters.load(std::memory_order_relaxed) == 0) return;
+    {
+      std::lock_guard<std::mutex> lock(parking.mutex);
+      ++parking.epoch;
+    }
+    parking.wakeup.notify_one();
+  }
+
+  Shared shared;
+  Position enqueue;
+  Position dequeue;
+  Parking pushParking;
+  Parking popParking;
+};
+
+}  // namespace s21
+
+#endif  // MPMC_QUEUE_H
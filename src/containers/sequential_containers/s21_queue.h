@@ -2,35 +2,48 @@
 #define QUEUE_H
 
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 
+#include "../s21_node_pool.h"
 #include "s21_sequential_container.h"
 
 namespace s21 {
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 class queue : public sequential_container<T> {
  public:
   struct Node {
-    T data;
     Node* next;
-    explicit Node(const T& value) : data(value), next(nullptr) {}
+    union {
+      T data;
+    };
+    Node() : next(nullptr) {}
+    ~Node() {}
   };
 
   using value_type = typename sequential_container<T>::value_type;
   using reference = typename sequential_container<T>::reference;
   using const_reference = typename sequential_container<T>::const_reference;
   using size_type = typename sequential_container<T>::size_type;
+  using allocator_type = Allocator;
 
-  queue() : frontNode(nullptr), backNode(nullptr) {}
+  queue() : queue(allocator_type()) {}
 
-  explicit queue(std::initializer_list<value_type> const& items)
-      : frontNode(nullptr), backNode(nullptr) {
+  explicit queue(const allocator_type& alloc)
+      : frontNode(nullptr), backNode(nullptr), nodeAlloc(alloc) {}
+
+  explicit queue(std::initializer_list<value_type> const& items,
+                 const allocator_type& alloc = allocator_type())
+      : queue(alloc) {
     for (const value_type& item : items) {
       this->push(item);
     }
   }
 
-  queue(const queue& q) : frontNode(nullptr), backNode(nullptr) {
+  queue(const queue& q)
+      : queue(node_traits::select_on_container_copy_construction(
+            q.nodeAlloc)) {
     Node* current = q.frontNode;
     while (current != nullptr) {
       push(current->data);
@@ -38,25 +51,30 @@ class queue : public sequential_container<T> {
     }
   }
 
-  queue(queue&& q) noexcept : frontNode(q.frontNode), backNode(q.backNode) {
+  queue(queue&& q) noexcept
+      : frontNode(q.frontNode),
+        backNode(q.backNode),
+        nodeAlloc(std::move(q.nodeAlloc)) {
     q.frontNode = nullptr;
     q.backNode = nullptr;
   }
 
-  ~queue() {
-    while (frontNode != nullptr) {
-      Node* temp = frontNode;
-      frontNode = frontNode->next;
-      delete temp;
-    }
-  }
+  ~queue() { clearNodes(); }
 
-  queue& operator=(queue&& q) noexcept {
+  queue& operator=(queue&& q) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
     if (this != &q) {
-      while (frontNode != nullptr) {
-        Node* temp = frontNode;
-        frontNode = frontNode->next;
-        delete temp;
+      clearNodes();
+      if constexpr (node_traits::propagate_on_container_move_assignment::
+                        value) {
+        nodeAlloc = std::move(q.nodeAlloc);
+      } else if (nodeAlloc != q.nodeAlloc) {
+        while (!q.empty()) {
+          emplace(std::move(q.frontNode->data));
+          q.pop();
+        }
+        return *this;
       }
       frontNode = q.frontNode;
       backNode = q.backNode;
@@ -66,6 +84,8 @@ class queue : public sequential_container<T> {
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_type(nodeAlloc); }
+
   const_reference front() {
     if (frontNode != nullptr) {
       return frontNode->data;
@@ -94,8 +114,13 @@ class queue : public sequential_container<T> {
     return count;
   }
 
-  void push(const_reference value) override {
-    Node* newNode = new Node(value);
+  void push(const_reference value) override { emplace(value); }
+
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    Node* newNode = createNode(std::forward<Args>(args)...);
     if (backNode == nullptr) {
       frontNode = newNode;
       backNode = newNode;
@@ -109,17 +134,21 @@ class queue : public sequential_container<T> {
     if (frontNode != nullptr) {
       Node* temp = frontNode;
       frontNode = frontNode->next;
-      delete temp;
+      if (frontNode == nullptr) backNode = nullptr;
+      destroyNode(temp);
     } else {
       throw std::out_of_range("Queue is empty");
     }
   }
 
   void swap(sequential_container<T>& other) override {
-    auto* otherQueue = dynamic_cast<queue<T>*>(&other);
+    auto* otherQueue = dynamic_cast<queue*>(&other);
     if (otherQueue) {
       std::swap(frontNode, otherQueue->frontNode);
       std::swap(backNode, otherQueue->backNode);
+      if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(nodeAlloc, otherQueue->nodeAlloc);
+      }
     } else {
       throw std::invalid_argument(
           "Cannot swap with a different container type");
@@ -128,7 +157,7 @@ class queue : public sequential_container<T> {
 
   template <typename... Args>
   void insert_many_back(Args&&... args) {
-    (..., push(std::forward<Args>(args)));
+    (..., emplace(std::forward<Args>(args)));
   }
 
   class iterator {
@@ -173,8 +202,44 @@ class queue : public sequential_container<T> {
   iterator end() { return iterator(nullptr); }
 
  private:
+  using value_traits = std::allocator_traits<allocator_type>;
+  using node_allocator = typename value_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  template <typename... Args>
+  Node* createNode(Args&&... args) {
+    Node* node = ::new (static_cast<void*>(node_traits::allocate(nodeAlloc, 1)))
+        Node();
+    try {
+      allocator_type alloc(nodeAlloc);
+      value_traits::construct(alloc, std::addressof(node->data),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(nodeAlloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(Node* node) noexcept {
+    allocator_type alloc(nodeAlloc);
+    value_traits::destroy(alloc, std::addressof(node->data));
+    node->~Node();
+    node_traits::deallocate(nodeAlloc, node, 1);
+  }
+
+  void clearNodes() noexcept {
+    while (frontNode != nullptr) {
+      Node* temp = frontNode;
+      frontNode = frontNode->next;
+      destroyNode(temp);
+    }
+    backNode = nullptr;
+  }
+
   Node* frontNode;
   Node* backNode;
+  node_allocator nodeAlloc;
 };
 
 }  // namespace s21
@@ -0,0 +1,354 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Vector with the same interface as s21::Vector that keeps up to N elements
+// in an inline buffer and only moves to the heap once it outgrows it.
+template <typename T, size_t N>
+class SmallVector {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using iterator = typename Vector<T>::iterator;
+  using const_iterator = typename Vector<T>::const_iterator;
+
+  SmallVector()
+      : v_size_(0U),
+        v_capacity_(N),
+        arr_(Inline()) {}  // default constructor, creates empty vector
+
+  explicit SmallVector(size_type n) : SmallVector() {
+    Reserve(n);
+    std::uninitialized_value_construct_n(arr_, n);
+    v_size_ = n;
+  }  // parameterized constructor, creates the vector of size n
+
+  explicit SmallVector(std::initializer_list<value_type> const& items)
+      : SmallVector() {
+    Reserve(items.size());
+    std::uninitialized_copy(items.begin(), items.end(), arr_);
+    v_size_ = items.size();
+  }  // initializer list constructor
+
+  SmallVector(const SmallVector& v) : SmallVector() {
+    Reserve(v.v_size_);
+    std::uninitialized_copy(v.arr_, v.arr_ + v.v_size_, arr_);
+    v_size_ = v.v_size_;
+  }  // copy constructor
+
+  SmallVector(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>)
+      : SmallVector() {
+    Steal(v);
+  }  // move constructor, takes the heap buffer or moves inline elements
+
+  ~SmallVector() {
+    std::destroy_n(arr_, v_size_);
+    if (!Is_Inline()) Deallocate(arr_, v_capacity_);
+  }  // destructor
+
+  SmallVector& operator=(const SmallVector& v) {
+    if (this != &v) {
+      SmallVector tmp(v);
+      Reset();
+      Steal(tmp);
+    }
+    return *this;
+  }  // copy assignment
+
+  SmallVector& operator=(SmallVector&& v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>) {
+    if (this != &v) {
+      Reset();
+      Steal(v);
+    }
+    return *this;
+  }  // move assignment
+
+  // Element access
+  reference At(size_type pos) {
+    if (pos >= v_size_) {
+      throw std::out_of_range("Incorrect index");
+    }
+    return arr_[pos];
+  }  // access specified element with bounds checking
+
+  const_reference At(size_type pos) const {
+    if (pos >= v_size_) {
+      throw std::out_of_range("Incorrect index");
+    }
+    return arr_[pos];
+  }  // access specified element with bounds checking
+
+  reference operator[](size_type pos) {
+    S21_ASSERT_INDEX(pos < v_size_);
+    return arr_[pos];
+  }
+
+  const_reference operator[](size_type pos) const {
+    S21_ASSERT_INDEX(pos < v_size_);
+    return arr_[pos];
+  }
+
+  const_reference Front() const {
+    if (v_size_ == 0) {
+      throw std::out_of_range("Incorrect index");
+    }
+    return arr_[0];
+  }
+
+  const_reference Back() const {
+    if (v_size_ == 0) {
+      throw std::out_of_range("Incorrect index");
+    }
+    return arr_[v_size_ - 1];
+  }
+
+  value_type* Data() { return arr_; }
+
+  // Iterators
+  iterator Begin() { return iterator(arr_); }
+
+  const_iterator Cbegin() const { return const_iterator(arr_); }
+
+  iterator End() { return iterator(arr_ + v_size_); }
+
+  const_iterator Cend() const { return const_iterator(arr_ + v_size_); }
+
+  // Capacity
+  bool empty() const { return (v_size_ == 0); }
+
+  size_type Size() const { return v_size_; }
+
+  size_type Max_Size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  size_type Capacity() const { return v_capacity_; }
+
+  bool Is_Inline() const {
+    return arr_ == Inline();
+  }  // true while the elements live in the inline buffer
+
+  void Reserve(size_type new_cap) {
+    if (new_cap > Max_Size()) {
+      throw std::length_error("SmallVector capacity exceeds max size");
+    }
+    if (new_cap > v_capacity_) {
+      Reallocate(new_cap);
+    }
+  }
+
+  void Shrink_To_Fit() {
+    if (Is_Inline() || v_size_ == v_capacity_) return;
+    if (v_size_ <= N) {
+      value_type* heap = arr_;
+      Relocate(heap, heap + v_size_, Inline());
+      Release(heap, v_size_);
+      Deallocate(heap, v_capacity_);
+      arr_ = Inline();
+      v_capacity_ = N;
+    } else {
+      Reallocate(v_size_);
+    }
+  }  // moves the elements back inline when they fit
+
+  // Modifiers
+  void Clear() {
+    std::destroy_n(arr_, v_size_);
+    v_size_ = 0;
+  }  // destroys the contents, capacity is kept
+
+  iterator Insert(iterator pos, const_reference value) {
+    return Emplace(pos, value);
+  }
+
+  iterator Insert(iterator pos, value_type&& value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator Emplace(const_iterator pos, Args&&... args) {
+    const size_type new_pos = pos - Cbegin();
+    if (new_pos == v_size_) {
+      Emplace_Back(std::forward<Args>(args)...);
+      return iterator(arr_ + new_pos);
+    }
+    value_type tmp(std::forward<Args>(args)...);
+    Insert_Range(new_pos, &tmp, 1);
+    return iterator(arr_ + new_pos);
+  }  // builds the element first, so args may refer to this vector
+
+  void Erase(iterator pos) {
+    const size_type new_pos = pos - Begin();
+    if (new_pos >= v_size_) {
+      throw std::out_of_range("Incorrect index");
+    }
+    std::move(arr_ + new_pos + 1, arr_ + v_size_, arr_ + new_pos);
+    Pop_Back();
+  }  // erases element at pos
+
+  void Push_Back(const_reference value) { Emplace_Back(value); }
+
+  void Push_Back(value_type&& value) { Emplace_Back(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace_Back(Args&&... args) {
+    if (v_size_ == v_capacity_) {
+      value_type tmp(std::forward<Args>(args)...);
+      Reallocate(Next_Capacity());
+      new (arr_ + v_size_) value_type(std::move(tmp));
+    } else {
+      new (arr_ + v_size_) value_type(std::forward<Args>(args)...);
+    }
+    return arr_[v_size_++];
+  }  // constructs an element in place at the end
+
+  void Pop_Back() {
+    if (v_size_ > 0) {
+      --v_size_;
+      std::destroy_at(arr_ + v_size_);
+    }
+  }
+
+  void Swap(SmallVector& other) {
+    SmallVector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+
+  template <typename... Args>
+  iterator Insert_Many(const_iterator pos, Args&&... args) {
+    const size_type new_pos = pos - Cbegin();
+    if constexpr (sizeof...(Args) > 0) {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      Insert_Range(new_pos, items, sizeof...(Args));
+    }
+    return Begin() + (new_pos + sizeof...(Args));
+  }  // shifts the tail once and moves all new elements into the gap
+
+  template <typename... Args>
+  void Insert_Many_Back(Args&&... args) {
+    Insert_Many(Cend(), std::forward<Args>(args)...);
+  }  // every element is built before the storage may move, so args may
+     // refer to elements of this vector
+
+ private:
+  using allocator_type = std::allocator<value_type>;
+  using ops = ArrayOps<value_type, allocator_type>;
+
+  static inline allocator_type alloc_{};  // stateless, shared by all
+
+  value_type* Inline() { return reinterpret_cast<value_type*>(inline_); }
+
+  const value_type* Inline() const {
+    return reinterpret_cast<const value_type*>(inline_);
+  }
+
+  static value_type* Allocate(size_type n) {
+    return alloc_.allocate(n);
+  }
+
+  static void Deallocate(value_type* p, size_type n) noexcept {
+    alloc_.deallocate(p, n);
+  }
+
+  static void Relocate(value_type* first, value_type* last,
+                       value_type* dest) {
+    ops::Relocate(alloc_, first, last, dest);
+  }
+
+  static void Release(value_type* first, size_type n) noexcept {
+    ops::Release(alloc_, first, n);
+  }
+
+  void Reallocate(size_type new_cap) {
+    value_type* new_arr = Allocate(new_cap);
+    try {
+      Relocate(arr_, arr_ + v_size_, new_arr);
+    } catch (...) {
+      Deallocate(new_arr, new_cap);
+      throw;
+    }
+    Release(arr_, v_size_);
+    if (!Is_Inline()) Deallocate(arr_, v_capacity_);
+    arr_ = new_arr;
+    v_capacity_ = new_cap;
+  }  // always ends up on the heap, the inline buffer is never re-entered here
+
+  void Insert_Range(size_type pos, value_type* items, size_type count) {
+    if (v_size_ + count <= v_capacity_) {
+      ops::Insert_In_Place(alloc_, arr_, v_size_, pos, items, count);
+      return;
+    }
+    const size_type new_cap = std::max(Next_Capacity(), v_size_ + count);
+    value_type* new_arr = Allocate(new_cap);
+    try {
+      ops::Insert_Relocating(alloc_, arr_, v_size_, pos, items, count,
+                             new_arr);
+    } catch (...) {
+      Deallocate(new_arr, new_cap);
+      throw;
+    }
+    Release(arr_, v_size_);
+    if (!Is_Inline()) Deallocate(arr_, v_capacity_);
+    arr_ = new_arr;
+    v_capacity_ = new_cap;
+    v_size_ += count;
+  }  // moves count ready-made elements into the gap opened at pos
+
+  size_type Next_Capacity() const {
+    if (v_capacity_ >= Max_Size()) {
+      throw std::length_error("SmallVector capacity exceeds max size");
+    }
+    return std::max<size_type>(std::min(v_capacity_ * 2, Max_Size()), 1);
+  }
+
+  void Steal(SmallVector& v) {
+    if (v.Is_Inline()) {
+      Relocate(v.arr_, v.arr_ + v.v_size_, arr_);
+      Release(v.arr_, v.v_size_);
+      v_size_ = v.v_size_;
+      v.v_size_ = 0;
+    } else {
+      arr_ = v.arr_;
+      v_size_ = v.v_size_;
+      v_capacity_ = v.v_capacity_;
+      v.arr_ = v.Inline();
+      v.v_size_ = 0;
+      v.v_capacity_ = N;
+    }
+  }  // expects *this to be empty and inline
+
+  void Reset() noexcept {
+    Clear();
+    if (!Is_Inline()) {
+      Deallocate(arr_, v_capacity_);
+      arr_ = Inline();
+      v_capacity_ = N;
+    }
+  }  // drops the elements and returns to the inline buffer
+
+  size_type v_size_;
+  size_type v_capacity_;
+  value_type* arr_;
+  alignas(value_type) unsigned char inline_[(N ? N : 1) * sizeof(value_type)];
+};
+}  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H
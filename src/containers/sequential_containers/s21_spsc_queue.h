@@ -0,0 +1,227 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+// Bounded FIFO between exactly one producer thread and one consumer thread,
+// on a ring buffer allocated once. The producer owns the write index and
+// the consumer the read index, each on its own cache line together with a
+// cached copy of the other side's index, so a push or pop only reads the
+// other side's line when the cached copy says the ring looks full or empty.
+// Indices grow without wrapping and pick a slot by masking, so the capacity
+// is rounded up to a power of two.
+//
+// push, emplace and the try_push variants may only be called by the
+// producer; front, pop and the try_pop variants only by the consumer.
+// empty, size and capacity are safe anywhere, but on the other side they
+// report a state that may already be out of date. push blocks while the
+// ring is full, pop and front throw when it is empty, like s21::queue.
+template <typename T, typename Allocator = std::allocator<T>>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+  using allocator_type = Allocator;
+
+  static constexpr size_type kCacheLine = 64;
+
+  explicit spsc_queue(size_type capacity,
+                      const allocator_type& alloc = allocator_type())
+      : shared(alloc, roundUp(capacity)) {}
+
+  spsc_queue(const spsc_queue&) = delete;
+  spsc_queue& operator=(const spsc_queue&) = delete;
+
+  ~spsc_queue() {
+    const size_type end = producer.writeIndex.load(std::memory_order_relaxed);
+    for (size_type i = consumer.readIndex.load(std::memory_order_relaxed);
+         i != end; ++i)
+      value_traits::destroy(shared.alloc, slot(i));
+    value_traits::deallocate(shared.alloc, shared.slots, shared.mask + 1);
+  }
+
+  allocator_type get_allocator() const { return shared.alloc; }
+
+  size_type capacity() const noexcept { return shared.mask + 1; }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    const size_type read = consumer.readIndex.load(std::memory_order_acquire);
+    const size_type write =
+        producer.writeIndex.load(std::memory_order_acquire);
+    return std::min(write - read, capacity());
+  }  // the read index is loaded first, so it never passes the write index
+
+  template <typename... Args>
+  bool try_emplace(Args&&... args) {
+    const size_type write = producer.writeIndex.load(std::memory_order_relaxed);
+    if (write - producer.readIndexCache == capacity()) {
+      producer.readIndexCache =
+          consumer.readIndex.load(std::memory_order_acquire);
+      if (write - producer.readIndexCache == capacity()) return false;
+    }
+    value_traits::construct(shared.alloc, slot(write),
+                            std::forward<Args>(args)...);
+    producer.writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type&& value) { return try_emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    for (unsigned spins = 0; !try_emplace(std::forward<Args>(args)...);)
+      backoff(spins);
+  }  // args are only used by the attempt that succeeds
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  // Pushes up to n values read from first, as many as fit, and publishes
+  // them to the consumer at once. Returns how many were pushed.
+  template <typename InputIt>
+  size_type try_push_n(InputIt first, size_type n) {
+    const size_type write = producer.writeIndex.load(std::memory_order_relaxed);
+    if (capacity() - (write - producer.readIndexCache) < n)
+      producer.readIndexCache =
+          consumer.readIndex.load(std::memory_order_acquire);
+    const size_type count =
+        std::min(n, capacity() - (write - producer.readIndexCache));
+    size_type done = 0;
+    try {
+      for (; done < count; ++done, ++first)
+        value_traits::construct(shared.alloc, slot(write + done), *first);
+    } catch (...) {
+      producer.writeIndex.store(write + done, std::memory_order_release);
+      throw;
+    }
+    producer.writeIndex.store(write + count, std::memory_order_release);
+    return count;
+  }
+
+  reference front() {
+    if (!available(1)) throw std::out_of_range("Queue is empty");
+    return *slot(consumer.readIndex.load(std::memory_order_relaxed));
+  }
+
+  void pop() {
+    if (!available(1)) throw std::out_of_range("Queue is empty");
+    const size_type read = consumer.readIndex.load(std::memory_order_relaxed);
+    value_traits::destroy(shared.alloc, slot(read));
+    consumer.readIndex.store(read + 1, std::memory_order_release);
+  }
+
+  bool try_pop(reference out) {
+    if (!available(1)) return false;
+    const size_type read = consumer.readIndex.load(std::memory_order_relaxed);
+    out = std::move(*slot(read));
+    value_traits::destroy(shared.alloc, slot(read));
+    consumer.readIndex.store(read + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Moves up to n values to out, as many as are queued, and hands their
+  // slots back to the producer at once. Returns how many were popped.
+  template <typename OutputIt>
+  size_type try_pop_n(OutputIt out, size_type n) {
+    available(n);
+    const size_type read = consumer.readIndex.load(std::memory_order_relaxed);
+    const size_type count = std::min(n, consumer.writeIndexCache - read);
+    size_type done = 0;
+    try {
+      for (; done < count; ++done, ++out) {
+        *out = std::move(*slot(read + done));
+        value_traits::destroy(shared.alloc, slot(read + done));
+      }
+    } catch (...) {
+      consumer.readIndex.store(read + done, std::memory_order_release);
+      throw;
+    }
+    consumer.readIndex.store(read + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  using value_traits = std::allocator_traits<allocator_type>;
+
+  struct alignas(kCacheLine) Producer {
+    std::atomic<size_type> writeIndex{0};
+    size_type readIndexCache = 0;
+  };
+
+  struct alignas(kCacheLine) Consumer {
+    std::atomic<size_type> readIndex{0};
+    size_type writeIndexCache = 0;
+  };
+
+  // Written once by the constructor and only read afterwards.
+  struct alignas(kCacheLine) Shared {
+    Shared(const allocator_type& allocator, size_type slotCount)
+        : alloc(allocator),
+          slots(value_traits::allocate(alloc, slotCount)),
+          mask(slotCount - 1) {}
+
+    allocator_type alloc;
+    T* slots;
+    size_type mask;
+  };
+
+  static size_type roundUp(size_type capacity) {
+    if (capacity == 0 || capacity > (SIZE_MAX >> 1) + 1)
+      throw std::length_error("spsc_queue capacity out of range");
+    size_type slots = 1;
+    while (slots < capacity) slots <<= 1;
+    return slots;
+  }
+
+  T* slot(size_type index) const noexcept {
+    return shared.slots + (index & shared.mask);
+  }
+
+  // Whether the consumer sees at least n queued values, rereading the write
+  // index only when the cached one says there are fewer.
+  bool available(size_type n) noexcept {
+    const size_type read = consumer.readIndex.load(std::memory_order_relaxed);
+    if (consumer.writeIndexCache - read < n)
+      consumer.writeIndexCache =
+          producer.writeIndex.load(std::memory_order_acquire);
+    return consumer.writeIndexCache - read >= n;
+  }
+
+  // Spins briefly, then yields the core so a producer and consumer sharing
+  // one CPU still make progress.
+  static void backoff(unsigned& spins) noexcept {
+    if (++spins < 64) {
+#if defined(__SSE2__)
+      _mm_pause();
+#endif
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  Shared shared;
+  Producer producer;
+  Consumer consumer;
+};
+
+}  // namespace s21
+
+#endif  // SPSC_QUEUE_H
@@ -2,37 +2,50 @@
 #define STACK_H
 
 #include <initializer_list>
+#include <memory>
 #include <stdexcept>
+#include <utility>
 
+#include "../s21_node_pool.h"
 #include "s21_sequential_container.h"
 
 namespace s21 {
 
-template <typename T>
+template <typename T, typename Allocator = PoolAllocator<T>>
 class stack : public sequential_container<T> {
  public:
   struct Node {
-    T data;
     Node* next;
-    explicit Node(const T& value) : data(value), next(nullptr) {}
+    union {
+      T data;
+    };
+    Node() : next(nullptr) {}
+    ~Node() {}
   };
 
   using value_type = typename sequential_container<T>::value_type;
   using reference = typename sequential_container<T>::reference;
   using const_reference = typename sequential_container<T>::const_reference;
   using size_type = typename sequential_container<T>::size_type;
+  using allocator_type = Allocator;
 
-  stack() : topNode(nullptr) {}
+  stack() : stack(allocator_type()) {}
 
-  explicit stack(std::initializer_list<value_type> const& items)
-      : topNode(nullptr) {
+  explicit stack(const allocator_type& alloc)
+      : topNode(nullptr), nodeAlloc(alloc) {}
+
+  explicit stack(std::initializer_list<value_type> const& items,
+                 const allocator_type& alloc = allocator_type())
+      : stack(alloc) {
     for (const value_type& item : items) {
       this->push(item);
     }
   }
 
-  stack(const stack& s) : topNode(nullptr) {
-    stack temp;
+  stack(const stack& s)
+      : stack(node_traits::select_on_container_copy_construction(
+            s.nodeAlloc)) {
+    stack temp(get_allocator());
     Node* current = s.topNode;
 
     while (current != nullptr) {
@@ -46,22 +59,32 @@ class stack : public sequential_container<T> {
     }
   }
 
-  stack(stack&& s) noexcept : topNode(s.topNode) { s.topNode = nullptr; }
-
-  ~stack() {
-    while (topNode != nullptr) {
-      Node* temp = topNode;
-      topNode = topNode->next;
-      delete temp;
-    }
+  stack(stack&& s) noexcept
+      : topNode(s.topNode), nodeAlloc(std::move(s.nodeAlloc)) {
+    s.topNode = nullptr;
   }
 
-  stack& operator=(stack&& s) noexcept {
+  ~stack() { clearNodes(); }
+
+  stack& operator=(stack&& s) noexcept(
+      node_traits::propagate_on_container_move_assignment::value ||
+      node_traits::is_always_equal::value) {
     if (this != &s) {
-      while (topNode != nullptr) {
-        Node* temp = topNode;
-        topNode = topNode->next;
-        delete temp;
+      clearNodes();
+      if constexpr (node_traits::propagate_on_container_move_assignment::
+                        value) {
+        nodeAlloc = std::move(s.nodeAlloc);
+      } else if (nodeAlloc != s.nodeAlloc) {
+        stack temp(get_allocator());
+        for (Node* cur = s.topNode; cur != nullptr; cur = cur->next) {
+          temp.emplace(std::move(cur->data));
+        }
+        while (!temp.empty()) {
+          emplace(std::move(temp.topNode->data));
+          temp.pop();
+        }
+        s.clearNodes();
+        return *this;
       }
       topNode = s.topNode;
       s.topNode = nullptr;
@@ -69,6 +92,8 @@ class stack : public sequential_container<T> {
     return *this;
   }
 
+  allocator_type get_allocator() const { return allocator_type(nodeAlloc); }
+
   const_reference top() {
     if (topNode != nullptr) {
       return topNode->data;
@@ -89,8 +114,13 @@ class stack : public sequential_container<T> {
     return count;
   }
 
-  void push(const_reference value) override {
-    Node* newNode = new Node(value);
+  void push(const_reference value) override { emplace(value); }
+
+  void push(value_type&& value) { emplace(std::move(value)); }
+
+  template <typename... Args>
+  void emplace(Args&&... args) {
+    Node* newNode = createNode(std::forward<Args>(args)...);
     newNode->next = topNode;
     topNode = newNode;
   }
@@ -99,16 +129,19 @@ class stack : public sequential_container<T> {
     if (topNode != nullptr) {
       Node* temp = topNode;
       topNode = topNode->next;
-      delete temp;
+      destroyNode(temp);
     } else {
       throw std::out_of_range("Stack is empty");
     }
   }
 
   void swap(sequential_container<T>& other) override {
-    auto* otherStack = dynamic_cast<stack<T>*>(&other);
+    auto* otherStack = dynamic_cast<stack*>(&other);
     if (otherStack) {
       std::swap(topNode, otherStack->topNode);
+      if constexpr (node_traits::propagate_on_container_swap::value) {
+        std::swap(nodeAlloc, otherStack->nodeAlloc);
+      }
     } else {
       throw std::invalid_argument(
           "Cannot swap with a different container type");
@@ -117,7 +150,7 @@ class stack : public sequential_container<T> {
 
   template <typename... Args>
   void insert_many_front(Args&&... args) {
-    (..., push(std::forward<Args>(args)));
+    (..., emplace(std::forward<Args>(args)));
   }
 
   class iterator {
@@ -162,7 +195,42 @@ class stack : public sequential_container<T> {
   iterator end() { return iterator(nullptr); }
 
  private:
+  using value_traits = std::allocator_traits<allocator_type>;
+  using node_allocator = typename value_traits::template rebind_alloc<Node>;
+  using node_traits = std::allocator_traits<node_allocator>;
+
+  template <typename... Args>
+  Node* createNode(Args&&... args) {
+    Node* node = ::new (static_cast<void*>(node_traits::allocate(nodeAlloc, 1)))
+        Node();
+    try {
+      allocator_type alloc(nodeAlloc);
+      value_traits::construct(alloc, std::addressof(node->data),
+                              std::forward<Args>(args)...);
+    } catch (...) {
+      node_traits::deallocate(nodeAlloc, node, 1);
+      throw;
+    }
+    return node;
+  }
+
+  void destroyNode(Node* node) noexcept {
+    allocator_type alloc(nodeAlloc);
+    value_traits::destroy(alloc, std::addressof(node->data));
+    node->~Node();
+    node_traits::deallocate(nodeAlloc, node, 1);
+  }
+
+  void clearNodes() noexcept {
+    while (topNode != nullptr) {
+      Node* temp = topNode;
+      topNode = topNode->next;
+      destroyNode(temp);
+    }
+  }
+
   Node* topNode;
+  node_allocator nodeAlloc;
 };
 
 }  // namespace s21
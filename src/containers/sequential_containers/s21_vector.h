@@ -1,23 +1,178 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
 #include <utility>
 
+// Define S21_CHECKED_ACCESS to make an out-of-range operator[] report the
+// failed check and abort, whether or not NDEBUG is set; At() stays checked
+// in every build.
+#ifndef S21_ASSERT_INDEX
+#ifdef S21_CHECKED_ACCESS
+#define S21_ASSERT_INDEX(cond)  \
+  ((cond) ? static_cast<void>(0) \
+          : s21::Index_Failure(#cond, __FILE__, __LINE__))
+#else
+#define S21_ASSERT_INDEX(cond) static_cast<void>(0)
+#endif
+#endif
+
 namespace s21 {
+[[noreturn]] inline void Index_Failure(const char* cond, const char* file,
+                                       int line) noexcept {
+  std::fprintf(stderr, "%s:%d: index out of range: %s\n", file, line, cond);
+  std::abort();
+}  // the S21_CHECKED_ACCESS failure path, kept out of line of operator[]
+
+// Types for which moving an object to a new address and dropping the source
+// is equivalent to memcpy. Specialize it for types such as owning handles
+// that are not trivially copyable but do not depend on their own address.
 template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Element moves on raw storage, shared by Vector and SmallVector. The caller
+// owns the memory, alloc only constructs and destroys the elements in it.
+template <typename T, typename Allocator>
+struct ArrayOps {
+  using size_type = size_t;
+  using alloc_traits = std::allocator_traits<Allocator>;
+
+  static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+
+  template <typename... Args>
+  static void Construct(Allocator& alloc, T* p, Args&&... args) {
+    alloc_traits::construct(alloc, p, std::forward<Args>(args)...);
+  }
+
+  static void Destroy(Allocator& alloc, T* first, size_type n) noexcept {
+    for (; n > 0; --n, ++first) alloc_traits::destroy(alloc, first);
+  }
+
+  template <typename InputIt>
+  static void Construct_Range(Allocator& alloc, InputIt first, InputIt last,
+                              T* dest) {
+    T* cur = dest;
+    try {
+      for (; first != last; ++first, ++cur) Construct(alloc, cur, *first);
+    } catch (...) {
+      Destroy(alloc, dest, cur - dest);
+      throw;
+    }
+  }  // copies or moves a range into raw storage
+
+  static void Relocate(Allocator& alloc, T* first, T* last, T* dest) {
+    if constexpr (kRelocatable) {
+      if (first != last) {
+        std::memcpy(static_cast<void*>(dest), first,
+                    (last - first) * sizeof(T));
+      }
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                         !std::is_copy_constructible_v<T>) {
+      Construct_Range(alloc, std::make_move_iterator(first),
+                      std::make_move_iterator(last), dest);
+    } else {
+      Construct_Range(alloc, first, last, dest);
+    }
+  }  // moves only when it cannot throw, so growth keeps the strong guarantee
+
+  static void Release(Allocator& alloc, T* first, size_type n) noexcept {
+    if constexpr (!kRelocatable) {
+      Destroy(alloc, first, n);
+    }
+  }  // ends the lifetime of relocated-from elements, a no-op after memcpy
+
+  // Lays out the size elements of arr in new_arr with count ready-made
+  // items moved in at pos. new_arr is left empty if this throws.
+  static void Insert_Relocating(Allocator& alloc, T* arr, size_type size,
+                                size_type pos, T* items, size_type count,
+                                T* new_arr) {
+    int stage = 0;
+    try {
+      Construct_Range(alloc, std::make_move_iterator(items),
+                      std::make_move_iterator(items + count), new_arr + pos);
+      stage = 1;
+      Relocate(alloc, arr, arr + pos, new_arr);
+      stage = 2;
+      Relocate(alloc, arr + pos, arr + size, new_arr + pos + count);
+    } catch (...) {
+      if (stage > 0) Destroy(alloc, new_arr + pos, count);
+      if (stage > 1) Destroy(alloc, new_arr, pos);
+      throw;
+    }
+  }
+
+  // Shifts the tail of the size elements of arr once and moves count
+  // ready-made items into the gap at pos. arr must have room for them;
+  // size counts every constructed element even if a move throws.
+  static void Insert_In_Place(Allocator& alloc, T* arr, size_type& size,
+                              size_type pos, T* items, size_type count) {
+    if constexpr (kRelocatable && std::is_nothrow_move_constructible_v<T>) {
+      std::memmove(static_cast<void*>(arr + pos + count), arr + pos,
+                   (size - pos) * sizeof(T));
+      Construct_Range(alloc, std::make_move_iterator(items),
+                      std::make_move_iterator(items + count), arr + pos);
+      size += count;
+    } else {
+      const size_type old_size = size;
+      const size_type tail = old_size - pos;
+      if (tail > count) {
+        Construct_Range(alloc, std::make_move_iterator(arr + old_size - count),
+                        std::make_move_iterator(arr + old_size),
+                        arr + old_size);
+        size += count;
+        std::move_backward(arr + pos, arr + old_size - count, arr + old_size);
+        std::move(items, items + count, arr + pos);
+      } else {
+        Construct_Range(alloc, std::make_move_iterator(items + tail),
+                        std::make_move_iterator(items + count),
+                        arr + old_size);
+        try {
+          Construct_Range(alloc, std::make_move_iterator(arr + pos),
+                          std::make_move_iterator(arr + old_size),
+                          arr + pos + count);
+        } catch (...) {
+          Destroy(alloc, arr + old_size, count - tail);
+          throw;
+        }
+        size += count;
+        std::move(items, items + tail, arr + pos);
+      }
+    }
+  }
+};
+
+template <typename T, typename Allocator = std::allocator<T>>
 class Vector {
  public:
+  class VectorIteratorConst;
+
   class VectorIterator {
    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+
     VectorIterator() : cur_(nullptr) {}
     explicit VectorIterator(T* cur_) : cur_(cur_) {}
 
-    T& operator*() { return (*cur_); }
+    operator VectorIteratorConst() const { return VectorIteratorConst(cur_); }
+
+    reference operator*() const { return *cur_; }
+    pointer operator->() const { return cur_; }
+    reference operator[](difference_type n) const { return cur_[n]; }
 
     VectorIterator& operator++() {
       ++cur_;
@@ -41,16 +196,33 @@ class Vector {
       return tmp;
     }
 
-    VectorIterator& operator+(size_t val) {
-      cur_ += val;
+    VectorIterator& operator+=(difference_type n) {
+      cur_ += n;
       return *this;
     }
 
-    VectorIterator& operator-(size_t val) {
-      cur_ -= val;
+    VectorIterator& operator-=(difference_type n) {
+      cur_ -= n;
       return *this;
     }
 
+    VectorIterator operator+(difference_type n) const {
+      return VectorIterator(cur_ + n);
+    }
+
+    friend VectorIterator operator+(difference_type n,
+                                    const VectorIterator& it) {
+      return it + n;
+    }
+
+    VectorIterator operator-(difference_type n) const {
+      return VectorIterator(cur_ - n);
+    }
+
+    difference_type operator-(const VectorIterator& other) const {
+      return cur_ - other.cur_;
+    }
+
     bool operator==(const VectorIterator& other) const {
       return (cur_ == other.cur_);
     }
@@ -59,16 +231,40 @@ class Vector {
       return (cur_ != other.cur_);
     }
 
+    bool operator<(const VectorIterator& other) const {
+      return cur_ < other.cur_;
+    }
+
+    bool operator>(const VectorIterator& other) const {
+      return cur_ > other.cur_;
+    }
+
+    bool operator<=(const VectorIterator& other) const {
+      return cur_ <= other.cur_;
+    }
+
+    bool operator>=(const VectorIterator& other) const {
+      return cur_ >= other.cur_;
+    }
+
    private:
     T* cur_;
   };
 
   class VectorIteratorConst {
    public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = const T&;
+
     VectorIteratorConst() : cur_(nullptr) {}
     explicit VectorIteratorConst(T* cur_) : cur_(cur_) {}
 
-    T& operator*() const { return *cur_; }
+    reference operator*() const { return *cur_; }
+    pointer operator->() const { return cur_; }
+    reference operator[](difference_type n) const { return cur_[n]; }
 
     VectorIteratorConst& operator++() {
       ++cur_;
@@ -92,6 +288,33 @@ class Vector {
       return tmp;
     }
 
+    VectorIteratorConst& operator+=(difference_type n) {
+      cur_ += n;
+      return *this;
+    }
+
+    VectorIteratorConst& operator-=(difference_type n) {
+      cur_ -= n;
+      return *this;
+    }
+
+    VectorIteratorConst operator+(difference_type n) const {
+      return VectorIteratorConst(cur_ + n);
+    }
+
+    friend VectorIteratorConst operator+(difference_type n,
+                                         const VectorIteratorConst& it) {
+      return it + n;
+    }
+
+    VectorIteratorConst operator-(difference_type n) const {
+      return VectorIteratorConst(cur_ - n);
+    }
+
+    difference_type operator-(const VectorIteratorConst& other) const {
+      return cur_ - other.cur_;
+    }
+
     bool operator==(const VectorIteratorConst& other) const {
       return (cur_ == other.cur_);
     }
@@ -100,6 +323,22 @@ class Vector {
       return (cur_ != other.cur_);
     }
 
+    bool operator<(const VectorIteratorConst& other) const {
+      return cur_ < other.cur_;
+    }
+
+    bool operator>(const VectorIteratorConst& other) const {
+      return cur_ > other.cur_;
+    }
+
+    bool operator<=(const VectorIteratorConst& other) const {
+      return cur_ <= other.cur_;
+    }
+
+    bool operator>=(const VectorIteratorConst& other) const {
+      return cur_ >= other.cur_;
+    }
+
    private:
     T* cur_;
   };
@@ -110,57 +349,98 @@ class Vector {
   using size_type = size_t;
   using iterator = VectorIterator;
   using const_iterator = VectorIteratorConst;
+  using allocator_type = Allocator;
 
   Vector()
       : v_size_(0U),
         v_capacity_(0U),
-        arr_(value_type()) {}  // default constructor, creates empty vector
+        arr_(nullptr),
+        alloc_() {}  // default constructor, creates empty vector
 
-  explicit Vector(size_type n)
-      : v_size_(n), v_capacity_(n), arr_(n ? new value_type[n] : value_type()) {
-    std::fill_n(arr_, n, value_type());
+  explicit Vector(const allocator_type& alloc)
+      : v_size_(0U),
+        v_capacity_(0U),
+        arr_(nullptr),
+        alloc_(alloc) {}  // creates empty vector that allocates from alloc
+
+  explicit Vector(size_type n, const allocator_type& alloc = allocator_type())
+      : Vector(alloc) {
+    arr_ = Allocate(n);
+    v_capacity_ = n;
+    Construct_N(arr_, n);
+    v_size_ = n;
   }  // parameterized constructor, creates the vector of size n
 
-  explicit Vector(std::initializer_list<value_type> const& items)
-      : v_size_(items.size()),
-        v_capacity_(items.size()),
-        arr_(new value_type[items.size()]) {
-    std::copy(items.begin(), items.end(), arr_);
+  explicit Vector(std::initializer_list<value_type> const& items,
+                  const allocator_type& alloc = allocator_type())
+      : Vector(alloc) {
+    arr_ = Allocate(items.size());
+    v_capacity_ = items.size();
+    Construct_Range(items.begin(), items.end(), arr_);
+    v_size_ = items.size();
   }  // initializer list constructor, creates vector initizialized using
      // std::initializer_list
 
-  Vector(const Vector& v) : Vector() {
-    arr_ = new value_type[v.v_capacity_];
+  Vector(const Vector& v)
+      : Vector(v, alloc_traits::select_on_container_copy_construction(
+                      v.alloc_)) {}  // copy constructor
+
+  Vector(const Vector& v, const allocator_type& alloc) : Vector(alloc) {
+    arr_ = Allocate(v.v_size_);
+    v_capacity_ = v.v_size_;
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (v.v_size_) std::memcpy(arr_, v.arr_, v.v_size_ * sizeof(value_type));
+    } else {
+      Construct_Range(v.arr_, v.arr_ + v.v_size_, arr_);
+    }
     v_size_ = v.v_size_;
-    v_capacity_ = v.v_capacity_;
-    for (size_type i = 0; i < v.Size(); ++i) arr_[i] = v.arr_[i];
-  }  // copy constructor
+  }  // copy constructor that allocates from alloc
 
-  Vector(Vector&& v)
-      : v_size_(v.v_size_), v_capacity_(v.v_capacity_), arr_(v.arr_) {
+  Vector(Vector&& v) noexcept
+      : v_size_(v.v_size_),
+        v_capacity_(v.v_capacity_),
+        arr_(v.arr_),
+        alloc_(std::move(v.alloc_)) {
     v.arr_ = nullptr;
     v.v_size_ = 0;
     v.v_capacity_ = 0;
   }  // move constructor
 
+  Vector(Vector&& v, const allocator_type& alloc) : Vector(alloc) {
+    if (alloc_ == v.alloc_) {
+      Steal(v);
+    } else {
+      Move_Elements_From(v);
+    }
+  }  // move constructor, moves element by element if the allocators differ
+
   ~Vector() {
-    v_size_ = 0;
-    v_capacity_ = 0;
-    delete[] arr_;
-    arr_ = nullptr;
+    Destroy(arr_, v_size_);
+    Deallocate(arr_, v_capacity_);
   }  // destructor
 
-  Vector& operator=(Vector&& v) {
-    v_size_ = v.v_size_;
-    v.v_size_ = 0;
-    v_capacity_ = v.v_capacity_;
-    v.v_capacity_ = 0;
-    delete[] arr_;
-    arr_ = v.arr_;
-    v.arr_ = nullptr;
+  Vector& operator=(Vector&& v) noexcept(
+      alloc_traits::propagate_on_container_move_assignment::value ||
+      alloc_traits::is_always_equal::value) {
+    if (this != &v) {
+      if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                        value) {
+        Reset();
+        alloc_ = std::move(v.alloc_);
+        Steal(v);
+      } else if (alloc_ == v.alloc_) {
+        Reset();
+        Steal(v);
+      } else {
+        Clear();
+        Move_Elements_From(v);
+      }
+    }
     return *this;
   }  // assignment operator overload for moving object
 
+  allocator_type Get_Allocator() const { return alloc_; }
+
   // Vector Element access
   reference At(size_type pos) {
     if (pos >= v_size_) {
@@ -169,29 +449,32 @@ class Vector {
     return arr_[pos];
   }  // access specified element with bounds checking
 
-  reference operator[](size_type pos) {
+  const_reference At(size_type pos) const {
     if (pos >= v_size_) {
       throw std::out_of_range("Incorrect index");
     }
     return arr_[pos];
-  }  // access specified element
+  }  // access specified element with bounds checking
+
+  reference operator[](size_type pos) {
+    S21_ASSERT_INDEX(pos < v_size_);
+    return arr_[pos];
+  }  // access specified element, unchecked unless S21_CHECKED_ACCESS is set
 
   const_reference operator[](size_type pos) const {
-    if (pos >= v_size_) {
-      throw std::out_of_range("Incorrect index");
-    }
+    S21_ASSERT_INDEX(pos < v_size_);
     return arr_[pos];
-  }  // access specified element
+  }  // access specified element, unchecked unless S21_CHECKED_ACCESS is set
 
   const_reference Front() const {
-    if (arr_ == nullptr) {
+    if (v_size_ == 0) {
       throw std::out_of_range("Incorrect index");
     }
     return arr_[0];
   }  // access the first element
 
   const_reference Back() const {
-    if (arr_ == nullptr) {
+    if (v_size_ == 0) {
       throw std::out_of_range("Incorrect index");
     }
     return arr_[v_size_ - 1];
@@ -218,21 +501,20 @@ class Vector {
   size_type Size() const { return v_size_; }  // returns the number of elements
 
   size_type Max_Size() const {
-    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+    return std::min<size_type>(
+        std::numeric_limits<size_type>::max() / sizeof(value_type) / 2,
+        alloc_traits::max_size(alloc_));
   }  // returns the maximum possible number of elements
 
   void Reserve(size_type new_cap) {
+    if (new_cap > Max_Size()) {
+      throw std::length_error("Vector capacity exceeds max size");
+    }
     if (new_cap > v_capacity_) {
-      value_type* new_arr = new value_type[new_cap];
-      for (size_t idx = 0; idx < v_size_; ++idx) {
-        new_arr[idx] = arr_[idx];
-      }
-      delete[] arr_;
-      arr_ = new_arr;
-      v_capacity_ = new_cap;
+      Reallocate(new_cap);
     }
-  }  // allocate storage of size elements and copies current array elements to a
-     // newely allocated array
+  }  // allocates raw storage for new_cap elements and relocates the current
+     // ones into it, no element is constructed for the spare capacity
 
   size_type Capacity() const {
     return v_capacity_;
@@ -241,86 +523,95 @@ class Vector {
 
   void Shrink_To_Fit() {
     if (v_size_ != v_capacity_) {
-      auto new_array = new value_type[v_size_];
-      for (size_type i = 0U; i < v_size_; ++i) {
-        new_array[i] = std::move(arr_[i]);
-      }
-      delete[] arr_;
-      arr_ = std::move(new_array);
-      v_capacity_ = v_size_;
+      Reallocate(v_size_);
     }
   }  // reduces memory usage by freeing unused memory
 
   // Vector Modifiers
   void Clear() {
-    delete[] arr_;
+    Destroy(arr_, v_size_);
     v_size_ = 0;
-    v_capacity_ = 0;
-    arr_ = nullptr;
-  }  // clears the contents
+  }  // destroys the contents, capacity is kept
 
   iterator Insert(iterator pos, const_reference value) {
-    iterator it = Begin();
-    size_t new_pos = 0U;
-    while (it != pos) {
-      ++new_pos;
-      ++it;
-    }
-    if (v_size_ + 1 >= v_capacity_) {
-      Reserve(v_capacity_ * 2);
-    }
-    for (size_t idx = v_size_; idx > new_pos; --idx) {
-      arr_[idx] = arr_[idx - 1];
-    }
-    arr_[new_pos] = value;
-    ++v_size_;
-    return iterator(arr_ + new_pos);
+    return Emplace(pos, value);
   }  // inserts elements into concrete pos and returns the iterator that points
      // to the new element
 
-  void Erase(iterator pos) {
-    iterator it = Begin();
-    size_t new_pos = 0U;
-    while (it != pos) {
-      ++new_pos;
-      ++it;
+  iterator Insert(iterator pos, value_type&& value) {
+    return Emplace(pos, std::move(value));
+  }
+
+  template <typename... Args>
+  iterator Emplace(const_iterator pos, Args&&... args) {
+    const size_type new_pos = pos - Cbegin();
+    if (v_size_ == v_capacity_) {
+      Realloc_Emplace(new_pos, std::forward<Args>(args)...);
+    } else if (new_pos == v_size_) {
+      Construct(arr_ + v_size_, std::forward<Args>(args)...);
+      ++v_size_;
+    } else if constexpr (kRelocatable &&
+                         std::is_nothrow_move_constructible_v<value_type>) {
+      value_type tmp(std::forward<Args>(args)...);
+      std::memmove(static_cast<void*>(arr_ + new_pos + 1), arr_ + new_pos,
+                   (v_size_ - new_pos) * sizeof(value_type));
+      Construct(arr_ + new_pos, std::move(tmp));
+      ++v_size_;
+    } else {
+      value_type tmp(std::forward<Args>(args)...);
+      Construct(arr_ + v_size_, std::move(arr_[v_size_ - 1]));
+      ++v_size_;
+      std::move_backward(arr_ + new_pos, arr_ + v_size_ - 2,
+                         arr_ + v_size_ - 1);
+      arr_[new_pos] = std::move(tmp);
     }
+    return iterator(arr_ + new_pos);
+  }  // constructs an element in place before pos
+
+  void Erase(iterator pos) {
+    const size_type new_pos = pos - Begin();
     if (new_pos >= v_size_) {
       throw std::out_of_range("Incorrect index");
     }
-    for (size_t idx = new_pos; idx < v_size_ - 1; ++idx) {
-      arr_[idx] = arr_[idx + 1];
+    if constexpr (kRelocatable) {
+      Destroy(arr_ + new_pos, 1);
+      std::memmove(static_cast<void*>(arr_ + new_pos), arr_ + new_pos + 1,
+                   (v_size_ - new_pos - 1) * sizeof(value_type));
+      --v_size_;
+    } else {
+      std::move(arr_ + new_pos + 1, arr_ + v_size_, arr_ + new_pos);
+      Pop_Back();
     }
-    --v_size_;
   }  // erases element at pos
 
   void Push_Back(const_reference value) {
-    if (v_size_ >= v_capacity_) {
-      Reserve(v_capacity_ ? v_capacity_ * 2 : 1);
-    }
-    value_type* new_arr = new value_type[v_size_ + 1U];
-    for (size_t idx = 0; idx < v_size_; ++idx) {
-      new_arr[idx] = arr_[idx];
+    Emplace_Back(value);
+  }  // adds an element to the end, amortized O(1)
+
+  void Push_Back(value_type&& value) { Emplace_Back(std::move(value)); }
+
+  template <typename... Args>
+  reference Emplace_Back(Args&&... args) {
+    if (v_size_ == v_capacity_) {
+      Realloc_Emplace(v_size_, std::forward<Args>(args)...);
+    } else {
+      Construct(arr_ + v_size_, std::forward<Args>(args)...);
+      ++v_size_;
     }
-    new_arr[v_size_] = value;
-    ++v_size_;
-    delete[] arr_;
-    arr_ = new_arr;
-  }  // adds an element to the end
+    return arr_[v_size_ - 1];
+  }  // constructs an element in place at the end
 
   void Pop_Back() {
     if (v_size_ > 0) {
-      value_type* new_arr = new value_type[v_size_ - 1U];
       --v_size_;
-      for (size_t idx = 0U; idx < v_size_; ++idx) {
-        new_arr[idx] = arr_[idx];
-      }
-      delete[] arr_;
-      arr_ = std::move(new_arr);
+      Destroy(arr_ + v_size_, 1);
     }
-  }  // removes the last element
+  }  // removes the last element, capacity is kept for further appends
 
   void Swap(Vector& other) {
+    if constexpr (alloc_traits::propagate_on_container_swap::value) {
+      std::swap(other.alloc_, alloc_);
+    }
     std::swap(other.arr_, arr_);
     std::swap(other.v_size_, v_size_);
     std::swap(other.v_capacity_, v_capacity_);
@@ -331,34 +622,163 @@ class Vector {
   // Bonus
   template <typename... Args>
   iterator Insert_Many(const_iterator pos, Args&&... args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    const_iterator it = Cbegin();
-    size_t new_pos = 0U;
-    while (it != pos) {
-      ++new_pos;
-      ++it;
-    }
-    for (auto const& i : args_v) {
-      Insert((Begin() + new_pos), i);
-      ++new_pos;
-    }
-    return (Begin() + new_pos);
-  }
+    const size_type new_pos = pos - Cbegin();
+    if constexpr (sizeof...(Args) > 0) {
+      value_type items[] = {value_type(std::forward<Args>(args))...};
+      Insert_Range(new_pos, items, sizeof...(Args));
+    }
+    return Begin() + (new_pos + sizeof...(Args));
+  }  // shifts the tail once and moves all new elements into the gap
 
   template <typename... Args>
   void Insert_Many_Back(Args&&... args) {
-    auto args_v =
-        std::initializer_list<value_type>{std::forward<Args>(args)...};
-    for (auto const& i : args_v) {
-      Push_Back(i);
+    Insert_Many(Cend(), std::forward<Args>(args)...);
+  }  // every element is built before the storage may move, so args may
+     // refer to elements of this vector
+
+ private:
+  using alloc_traits = std::allocator_traits<allocator_type>;
+
+  value_type* Allocate(size_type n) {
+    return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+  }  // raw uninitialized storage for n elements
+
+  void Deallocate(value_type* p, size_type n) noexcept {
+    if (p != nullptr) alloc_traits::deallocate(alloc_, p, n);
+  }
+
+  using ops = ArrayOps<value_type, allocator_type>;
+
+  template <typename... Args>
+  void Construct(value_type* p, Args&&... args) {
+    ops::Construct(alloc_, p, std::forward<Args>(args)...);
+  }
+
+  void Destroy(value_type* first, size_type n) noexcept {
+    ops::Destroy(alloc_, first, n);
+  }
+
+  void Construct_N(value_type* dest, size_type n) {
+    size_type done = 0;
+    try {
+      for (; done < n; ++done) Construct(dest + done);
+    } catch (...) {
+      Destroy(dest, done);
+      throw;
+    }
+  }  // value-initializes n elements, nothing is left behind on failure
+
+  template <typename InputIt>
+  void Construct_Range(InputIt first, InputIt last, value_type* dest) {
+    ops::Construct_Range(alloc_, first, last, dest);
+  }  // copies or moves a range into raw storage
+
+  void Steal(Vector& v) noexcept {
+    arr_ = v.arr_;
+    v_size_ = v.v_size_;
+    v_capacity_ = v.v_capacity_;
+    v.arr_ = nullptr;
+    v.v_size_ = 0;
+    v.v_capacity_ = 0;
+  }  // expects *this to own no storage
+
+  void Reset() noexcept {
+    Destroy(arr_, v_size_);
+    Deallocate(arr_, v_capacity_);
+    arr_ = nullptr;
+    v_size_ = 0;
+    v_capacity_ = 0;
+  }  // releases the elements and the storage
+
+  void Move_Elements_From(Vector& v) {
+    Reserve(v.v_size_);
+    Construct_Range(std::make_move_iterator(v.arr_),
+                    std::make_move_iterator(v.arr_ + v.v_size_), arr_);
+    v_size_ = v.v_size_;
+    v.Clear();
+  }  // used when the storage of v cannot be adopted
+
+  static constexpr bool kRelocatable = ops::kRelocatable;
+
+  void Relocate(value_type* first, value_type* last, value_type* dest) {
+    ops::Relocate(alloc_, first, last, dest);
+  }
+
+  void Release(value_type* first, size_type n) noexcept {
+    ops::Release(alloc_, first, n);
+  }
+
+  void Reallocate(size_type new_cap) {
+    value_type* new_arr = Allocate(new_cap);
+    try {
+      Relocate(arr_, arr_ + v_size_, new_arr);
+    } catch (...) {
+      Deallocate(new_arr, new_cap);
+      throw;
     }
+    Release(arr_, v_size_);
+    Deallocate(arr_, v_capacity_);
+    arr_ = new_arr;
+    v_capacity_ = new_cap;
   }
 
- private:
+  size_type Next_Capacity() const {
+    if (v_capacity_ >= Max_Size()) {
+      throw std::length_error("Vector capacity exceeds max size");
+    }
+    return v_capacity_ ? std::min(v_capacity_ * 2, Max_Size()) : 1;
+  }  // geometric growth keeps the amortized cost of appends constant
+
+  void Insert_Range(size_type pos, value_type* items, size_type count) {
+    if (v_size_ + count <= v_capacity_) {
+      ops::Insert_In_Place(alloc_, arr_, v_size_, pos, items, count);
+      return;
+    }
+    const size_type new_cap = std::max(Next_Capacity(), v_size_ + count);
+    value_type* new_arr = Allocate(new_cap);
+    try {
+      ops::Insert_Relocating(alloc_, arr_, v_size_, pos, items, count,
+                             new_arr);
+    } catch (...) {
+      Deallocate(new_arr, new_cap);
+      throw;
+    }
+    Release(arr_, v_size_);
+    Deallocate(arr_, v_capacity_);
+    arr_ = new_arr;
+    v_capacity_ = new_cap;
+    v_size_ += count;
+  }  // moves count ready-made elements into the gap opened at pos
+
+  template <typename... Args>
+  void Realloc_Emplace(size_type pos, Args&&... args) {
+    const size_type new_cap = Next_Capacity();
+    value_type* new_arr = Allocate(new_cap);
+    size_type constructed = 0;
+    try {
+      Construct(new_arr + pos, std::forward<Args>(args)...);
+      constructed = 1;
+      Relocate(arr_, arr_ + pos, new_arr);
+      constructed += pos;
+      Relocate(arr_ + pos, arr_ + v_size_, new_arr + pos + 1);
+    } catch (...) {
+      if (constructed > 0) Destroy(new_arr + pos, 1);
+      if (constructed > 1) Destroy(new_arr, pos);
+      Deallocate(new_arr, new_cap);
+      throw;
+    }
+    Release(arr_, v_size_);
+    Deallocate(arr_, v_capacity_);
+    arr_ = new_arr;
+    v_capacity_ = new_cap;
+    ++v_size_;
+  }  // the new element is built before the old buffer is released, so args
+     // may refer to elements of this vector
+
   size_type v_size_;
   size_type v_capacity_;
   value_type* arr_;
+  allocator_type alloc_;
 };
 }  // namespace s21
 
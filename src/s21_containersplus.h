@@ -1,7 +1,20 @@
 #ifndef CONTAINERSPLUS_H
 #define CONTAINERSPLUS_H
 
+#include "containers/associative_container/s21_btree_map.h"
+#include "containers/associative_container/s21_btree_multiset.h"
+#include "containers/associative_container/s21_btree_set.h"
+#include "containers/associative_container/s21_flat_hash_set.h"
+#include "containers/associative_container/s21_flat_map.h"
+#include "containers/associative_container/s21_flat_multiset.h"
+#include "containers/associative_container/s21_flat_set.h"
+#include "containers/associative_container/s21_unordered_map.h"
+#include "containers/associative_container/s21_unordered_set.h"
 #include "containers/associative_container/s21_multiset.h"
 #include "containers/s21_array.h"
+#include "containers/s21_node_pool.h"
+#include "containers/sequential_containers/s21_mpmc_queue.h"
+#include "containers/sequential_containers/s21_small_vector.h"
+#include "containers/sequential_containers/s21_spsc_queue.h"
 
 #endif  // CONTAINERSPLUS_H
@@ -0,0 +1,113 @@
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test.h"
+
+template class s21::btree_map<int, int>;
+
+namespace {
+using small_map = s21::btree_map<int, std::string, std::less<int>,
+                                 s21::PoolAllocator<std::pair<const int,
+                                                              std::string>>,
+                                 128>;
+
+// Counts its copies and throws from them once armed. Moves never throw,
+// so a container that only moves keys around keeps working.
+struct FragileKey {
+  static inline int copies = 0;
+  static inline bool armed = false;
+  explicit FragileKey(int v) noexcept : value(v) {}
+  FragileKey(const FragileKey &other) : value(other.value) {
+    ++copies;
+    if (armed) throw std::runtime_error("key copied");
+  }
+  FragileKey(FragileKey &&other) noexcept : value(other.value) {}
+  FragileKey &operator=(const FragileKey &) = default;
+  bool operator<(const FragileKey &other) const noexcept {
+    return value < other.value;
+  }
+  bool operator==(const FragileKey &other) const noexcept {
+    return value == other.value;
+  }
+  int value;
+};
+}  // namespace
+
+TEST(btree_map, InsertAtAndSubscript) {
+  s21::btree_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert((i * 31) % 1000, i);
+  EXPECT_EQ(m.size(), 1000);
+  EXPECT_EQ(m.at(31), 1);
+  EXPECT_THROW(m.at(1000), std::out_of_range);
+  m[1000] = 7;
+  EXPECT_EQ(m.at(1000), 7);
+  EXPECT_FALSE(m.insert(5, 0).second);
+  EXPECT_FALSE(m.insert_or_assign(5, -5).second);
+  EXPECT_EQ(m[5], -5);
+  EXPECT_TRUE(m.insert_or_assign(2000, 1).second);
+  EXPECT_EQ(m.size(), 1002);
+}
+
+TEST(btree_map, StringValuesSurviveSplitsAndMerges) {
+  small_map m;
+  std::map<int, std::string> expected;
+  for (int i = 0; i < 2000; ++i) {
+    const int key = (i * 7919) % 2000;
+    const std::string value = "value number " + std::to_string(key);
+    m.insert(key, value);
+    expected.emplace(key, value);
+  }
+  for (int i = 0; i < 2000; i += 3) {
+    m.erase(m.find(i));
+    expected.erase(i);
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &[key, value] : expected) {
+    EXPECT_EQ(it->first, key);
+    EXPECT_EQ(it->second, value);
+    ++it;
+  }
+}
+
+TEST(btree_map, BoundsAndTransparentLookup) {
+  s21::btree_map<std::string, int, std::less<>> m(
+      {{"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}});
+  EXPECT_EQ(m.lower_bound("b")->first, "bravo");
+  EXPECT_EQ(m.upper_bound("charlie")->first, "delta");
+  EXPECT_EQ(m.find(std::string_view("charlie"))->second, 3);
+  EXPECT_TRUE(m.contains(std::string_view("alpha")));
+  EXPECT_EQ(m.count("echo"), 0);
+  EXPECT_TRUE(m.value_comp()(*m.begin(), *m.find("delta")));
+}
+
+TEST(btree_map, MergeKeepsCollisionsInSource) {
+  s21::btree_map<int, std::string> target({{1, "a"}, {2, "b"}});
+  s21::btree_map<int, std::string> source({{2, "x"}, {3, "c"}});
+  target.merge(source);
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target.at(2), "b");
+  EXPECT_EQ(source.size(), 1);
+  EXPECT_EQ(source.at(2), "x");
+}
+
+TEST(btree_map, ShiftsMoveKeysInsteadOfCopying) {
+  s21::btree_map<FragileKey, int> m;
+  FragileKey::copies = 0;
+  for (int i = 0; i < 1000; ++i) m.insert(FragileKey((i * 37) % 1000), i);
+  EXPECT_LE(FragileKey::copies, 2000);  // building the pair, then storing it
+  FragileKey::copies = 0;
+  FragileKey::armed = true;
+  for (int i = 0; i < 1000; i += 2) m.erase(m.find(FragileKey(i)));
+  FragileKey::armed = false;
+  EXPECT_EQ(FragileKey::copies, 0);
+  EXPECT_EQ(m.size(), 500);
+  int expected = 1;
+  for (const auto &entry : m) {
+    EXPECT_EQ(entry.first.value, expected);
+    expected += 2;
+  }
+}
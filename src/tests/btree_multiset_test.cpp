@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "test.h"
+
+template class s21::btree_multiset<int>;
+
+namespace {
+using small_multiset =
+    s21::btree_multiset<int, std::less<int>, s21::PoolAllocator<int>, 32>;
+}  // namespace
+
+TEST(btree_multiset, KeepsDuplicatesInOrder) {
+  small_multiset ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    ms.insert(i % 17);
+    expected.insert(i % 17);
+  }
+  EXPECT_EQ(ms.size(), expected.size());
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin()));
+  for (int key = -1; key <= 17; ++key) {
+    EXPECT_EQ(ms.count(key), expected.count(key));
+    auto range = ms.equal_range(key);
+    const auto found = std::distance(range.first, range.second);
+    EXPECT_EQ(static_cast<std::size_t>(found), expected.count(key));
+  }
+  EXPECT_EQ(*ms.find(5), 5);
+}
+
+TEST(btree_multiset, RandomEraseMatchesStdMultiset) {
+  small_multiset ms;
+  std::multiset<int> expected;
+  unsigned state = 99U;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 60U);
+    if ((state >> 8) % 5U < 2U) {
+      auto it = ms.find(key);
+      auto std_it = expected.find(key);
+      ASSERT_EQ(it != ms.end(), std_it != expected.end());
+      if (std_it != expected.end()) {
+        ms.erase(it);
+        expected.erase(std_it);
+      }
+    } else {
+      ms.insert(key);
+      expected.insert(key);
+    }
+  }
+  EXPECT_EQ(ms.size(), expected.size());
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin()));
+}
+
+TEST(btree_multiset, SortedBuildAndMerge) {
+  std::vector<int> keys = {1, 1, 2, 3, 3, 3};
+  auto ms = small_multiset::from_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(ms.size(), 6);
+  small_multiset other({3, 0, 2});
+  ms.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(std::vector<int>(ms.begin(), ms.end()),
+            (std::vector<int>{0, 1, 1, 2, 2, 3, 3, 3, 3}));
+  EXPECT_EQ(ms.count(3), 4);
+}
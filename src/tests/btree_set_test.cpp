@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test.h"
+
+template class s21::btree_set<int>;
+
+namespace {
+// Four ints per node, so a few hundred keys already build a deep tree.
+using small_set =
+    s21::btree_set<int, std::less<int>, s21::PoolAllocator<int>, 32>;
+
+// Every leaf of a B-tree sits at the same depth.
+template <typename Set>
+bool LeavesLevel(Set &set) {
+  int depth = -1;
+  for (auto it = set.begin(); it != set.end(); ++it) {
+    if (!it.node_->leaf_) continue;
+    int d = 0;
+    for (auto node = it.node_; node->parent_ != nullptr; node = node->parent_)
+      ++d;
+    if (depth != -1 && d != depth) return false;
+    depth = d;
+  }
+  return true;
+}
+
+template <typename Set>
+std::vector<int> Items(const Set &set) {
+  return std::vector<int>(set.begin(), set.end());
+}
+}  // namespace
+
+TEST(btree_set, NodeSlotsFollowNodeBytes) {
+  EXPECT_EQ(small_set::tree_type::kSlots, 4);
+  EXPECT_GT(s21::btree_set<int>::tree_type::kSlots, 32);
+}
+
+TEST(btree_set, InsertFindAndOrder) {
+  s21::btree_set<int> set;
+  std::set<int> expected;
+  for (int i = 0; i < 5000; ++i) {
+    const int key = (i * 7919) % 3000;
+    EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  EXPECT_EQ(Items(set), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_TRUE(set.contains(2999));
+  EXPECT_FALSE(set.contains(3000));
+  EXPECT_EQ(*set.find(1234), 1234);
+  EXPECT_EQ(set.find(-5), set.end());
+}
+
+TEST(btree_set, RandomInsertEraseMatchesStdSet) {
+  small_set set;
+  std::set<int> expected;
+  unsigned state = 7U;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 700U);
+    if ((state >> 8) % 3U == 0U) {
+      auto it = set.find(key);
+      EXPECT_EQ(it != set.end(), expected.erase(key) == 1);
+      set.erase(it);
+    } else {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    }
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  EXPECT_EQ(Items(set), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_TRUE(LeavesLevel(set));
+  while (!set.empty()) set.erase(set.begin());
+  EXPECT_EQ(set.begin(), set.end());
+  set.insert(1);
+  EXPECT_EQ(set.size(), 1);
+}
+
+TEST(btree_set, IteratesBackwards) {
+  small_set set;
+  for (int i = 0; i < 300; ++i) set.insert(i);
+  auto it = set.find(299);
+  for (int expected = 299; expected > 0; --expected, --it)
+    ASSERT_EQ(*it, expected);
+  EXPECT_EQ(*it, 0);
+}
+
+TEST(btree_set, Bounds) {
+  small_set set;
+  for (int i = 0; i < 200; i += 2) set.insert(i);
+  EXPECT_EQ(*set.lower_bound(51), 52);
+  EXPECT_EQ(*set.lower_bound(52), 52);
+  EXPECT_EQ(*set.upper_bound(52), 54);
+  EXPECT_EQ(set.upper_bound(198), set.end());
+  EXPECT_EQ(set.lower_bound(199), set.end());
+  auto range = set.equal_range(10);
+  EXPECT_EQ(*range.first, 10);
+  EXPECT_EQ(*range.second, 12);
+  EXPECT_EQ(set.count(10), 1);
+  EXPECT_EQ(set.count(11), 0);
+}
+
+TEST(btree_set, SortedBuildFillsNodes) {
+  std::vector<int> keys(1000);
+  for (int i = 0; i < 1000; ++i) keys[i] = i;
+  auto set = small_set::from_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_EQ(Items(set), keys);
+  EXPECT_TRUE(LeavesLevel(set));
+  std::size_t packed = 0;  // keys in nodes short of at most one value
+  for (auto it = set.begin(); it != set.end(); ++it)
+    if (it.node_->count_ + 1U >= small_set::tree_type::kSlots) ++packed;
+  EXPECT_GT(packed, keys.size() * 9 / 10);
+  for (int i = 0; i < 1000; i += 2) set.erase(set.find(i));
+  EXPECT_EQ(set.size(), 500);
+  EXPECT_TRUE(LeavesLevel(set));
+}
+
+TEST(btree_set, RangeConstructorSortsAndDeduplicates) {
+  std::vector<int> keys = {5, 3, 9, 3, 1, 5};
+  s21::btree_set<int> set(keys.begin(), keys.end());
+  EXPECT_EQ(Items(set), (std::vector<int>{1, 3, 5, 9}));
+  s21::btree_set<int> listed({4, 2, 2, 8});
+  EXPECT_EQ(Items(listed), (std::vector<int>{2, 4, 8}));
+}
+
+TEST(btree_set, CopyMoveAndSwap) {
+  small_set original;
+  for (int i = 0; i < 500; ++i) original.insert((i * 37) % 500);
+  small_set copy(original);
+  EXPECT_EQ(Items(copy), Items(original));
+  copy.erase(copy.find(100));
+  EXPECT_TRUE(original.contains(100));
+  small_set moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 499);
+  EXPECT_TRUE(copy.empty());
+  small_set other({1, 2, 3});
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 499);
+  EXPECT_EQ(moved.size(), 3);
+  moved = original;
+  EXPECT_EQ(moved.size(), 500);
+}
+
+TEST(btree_set, MergeMovesMissingKeys) {
+  small_set target({1, 3, 5});
+  small_set source({2, 3, 4, 5, 6});
+  target.merge(source);
+  EXPECT_EQ(Items(target), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(Items(source), (std::vector<int>{3, 5}));
+}
+
+TEST(btree_set, StringsAndTransparentLookup) {
+  s21::btree_set<std::string, std::less<>> set;
+  for (int i = 0; i < 200; ++i)
+    set.insert("a-reasonably-long-key-" + std::to_string(i));
+  EXPECT_TRUE(set.contains(std::string_view("a-reasonably-long-key-42")));
+  EXPECT_FALSE(set.contains(std::string_view("missing")));
+  for (int i = 0; i < 200; i += 2)
+    set.erase(set.find("a-reasonably-long-key-" + std::to_string(i)));
+  EXPECT_EQ(set.size(), 100);
+}
+
+TEST(btree_set, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::btree_set<std::pmr::string, std::less<>,
+                 std::pmr::polymorphic_allocator<std::pmr::string>>
+      set(&resource);
+  set.insert(std::pmr::string("a string well beyond the small buffer"));
+  EXPECT_EQ(set.begin()->get_allocator().resource(), &resource);
+  EXPECT_EQ(set.get_allocator().resource(), &resource);
+}
@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "test.h"
+
+template class s21::flat_hash_set<int>;
+
+namespace {
+template <typename Set>
+std::vector<int> Sorted(const Set &set) {
+  std::vector<int> items(set.begin(), set.end());
+  std::sort(items.begin(), items.end());
+  return items;
+}
+
+struct ConstantHash {
+  std::size_t operator()(int) const noexcept { return 42; }
+};
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const noexcept {
+    return std::hash<std::string_view>()(key);
+  }
+};
+
+// Control bytes in every state a table can hold, 0..127 for full slots.
+std::vector<SwissTable::ctrl_t> RandomControlBytes(std::size_t n) {
+  std::vector<SwissTable::ctrl_t> ctrl(n);
+  unsigned state = 5U;
+  for (auto &byte : ctrl) {
+    state = state * 1103515245U + 12345U;
+    const unsigned pick = (state >> 16) % 8U;
+    if (pick == 0U)
+      byte = SwissTable::kEmpty;
+    else if (pick == 1U)
+      byte = SwissTable::kDeleted;
+    else
+      byte = static_cast<SwissTable::ctrl_t>((state >> 8) % 4U);
+  }
+  return ctrl;
+}
+
+template <typename Group>
+void ExpectGroupMatchesScalar(const std::vector<SwissTable::ctrl_t> &ctrl) {
+  using SwissTable::BitMask;
+  using SwissTable::ScalarGroup;
+  const auto bits = [](BitMask mask) {
+    std::uint32_t result = 0;
+    for (; mask; mask.clear_lowest()) result |= 1U << mask.lowest();
+    return result;
+  };
+  constexpr std::size_t halves = Group::kWidth / ScalarGroup::kWidth;
+  for (std::size_t at = 0; at + Group::kWidth <= ctrl.size(); ++at) {
+    const Group group(ctrl.data() + at);
+    std::uint32_t match = 0, empty = 0, free = 0;
+    for (std::size_t h = 0; h < halves; ++h) {
+      const ScalarGroup scalar(ctrl.data() + at + h * ScalarGroup::kWidth);
+      const unsigned shift = h * ScalarGroup::kWidth;
+      match |= bits(scalar.match(2)) << shift;
+      empty |= bits(scalar.match_empty()) << shift;
+      free |= bits(scalar.match_empty_or_deleted()) << shift;
+    }
+    ASSERT_EQ(bits(group.match(2)), match);
+    ASSERT_EQ(bits(group.match_empty()), empty);
+    ASSERT_EQ(bits(group.match_empty_or_deleted()), free);
+  }
+}
+}  // namespace
+
+TEST(flat_hash_set, SimdGroupsMatchScalarGroup) {
+  const auto ctrl = RandomControlBytes(4096);
+  ExpectGroupMatchesScalar<SwissTable::ScalarGroup>(ctrl);
+  ExpectGroupMatchesScalar<SwissTable::Group>(ctrl);
+#if !defined(S21_HASH_SCALAR_GROUPS) && defined(__SSE2__)
+  ExpectGroupMatchesScalar<SwissTable::Sse2Group>(ctrl);
+#endif
+}
+
+TEST(flat_hash_set, InsertFindAndErase) {
+  s21::flat_hash_set<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.find(1), set.end());
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_FALSE(set.contains(1));
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(set.insert(i * 7).second);
+  EXPECT_FALSE(set.insert(70).second);
+  EXPECT_EQ(*set.insert(70).first, 70);
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_TRUE(set.contains(6993));
+  EXPECT_FALSE(set.contains(6994));
+  EXPECT_EQ(set.count(14), 1);
+  EXPECT_EQ(*set.find(21), 21);
+  EXPECT_EQ(set.erase(21), 1);
+  EXPECT_EQ(set.erase(21), 0);
+  EXPECT_EQ(set.find(21), set.end());
+  EXPECT_EQ(set.size(), 999);
+  EXPECT_LE(set.load_factor(), set.max_load_factor());
+}
+
+TEST(flat_hash_set, RandomInsertEraseMatchesStdUnorderedSet) {
+  s21::flat_hash_set<int> set;
+  std::unordered_set<int> expected;
+  unsigned state = 17U;
+  for (int round = 0; round < 60000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 3000U);
+    if ((state >> 8) % 2U == 0U) {
+      EXPECT_EQ(set.erase(key), expected.erase(key));
+    } else {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    }
+    ASSERT_EQ(set.size(), expected.size());
+  }
+  EXPECT_EQ(Sorted(set),
+            Sorted(std::vector<int>(expected.begin(), expected.end())));
+  EXPECT_LE(set.bucket_count(), 8192);
+}
+
+TEST(flat_hash_set, EraseKeepsOtherValuesInPlace) {
+  s21::flat_hash_set<int> set;
+  set.reserve(2000);
+  for (int i = 0; i < 2000; ++i) set.insert(i);
+  const int *kept = &*set.find(1001);
+  for (auto it = set.begin(); it != set.end();) {
+    if (*it % 2 == 0)
+      it = set.erase(it);
+    else
+      ++it;
+  }
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_EQ(&*set.find(1001), kept);
+  for (int i = 0; i < 2000; ++i) EXPECT_EQ(set.contains(i), i % 2 == 1);
+}
+
+TEST(flat_hash_set, CollidingHashesStayCorrect) {
+  s21::flat_hash_set<int, ConstantHash> set;
+  for (int i = 0; i < 500; ++i) EXPECT_TRUE(set.insert(i).second);
+  for (int i = 0; i < 500; i += 2) EXPECT_EQ(set.erase(i), 1);
+  for (int i = 0; i < 500; ++i) EXPECT_EQ(set.contains(i), i % 2 == 1);
+  for (int i = 0; i < 500; i += 2) EXPECT_TRUE(set.insert(i).second);
+  EXPECT_EQ(set.size(), 500);
+}
+
+TEST(flat_hash_set, ReserveRehashAndClear) {
+  s21::flat_hash_set<int> set;
+  EXPECT_EQ(set.bucket_count(), 0);
+  set.reserve(1000);
+  const auto buckets = set.bucket_count();
+  EXPECT_GE(buckets * 7 / 8, 1000);
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  EXPECT_EQ(set.bucket_count(), buckets);
+  set.rehash(8192);
+  EXPECT_EQ(set.bucket_count(), 8192);
+  set.rehash(0);
+  EXPECT_EQ(set.bucket_count(), buckets);
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(set.contains(i));
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+  EXPECT_EQ(set.bucket_count(), buckets);
+}
+
+TEST(flat_hash_set, CopyMoveSwapAndMerge) {
+  s21::flat_hash_set<int> original({5, 1, 3});
+  s21::flat_hash_set<int> copy(original);
+  copy.erase(1);
+  EXPECT_TRUE(original.contains(1));
+  s21::flat_hash_set<int> moved(std::move(copy));
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{3, 5}));
+  moved = original;
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{1, 3, 5}));
+  s21::flat_hash_set<int> source({2, 3, 4, 5, 6});
+  moved.merge(source);
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(Sorted(source), (std::vector<int>{3, 5}));
+  moved.swap(source);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(source.size(), 6);
+  source.insert_many(7, 8, 3);
+  EXPECT_EQ(Sorted(source), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+}
+
+TEST(flat_hash_set, StringKeysWithTransparentLookup) {
+  s21::flat_hash_set<std::string, StringHash, std::equal_to<>> names;
+  for (int i = 0; i < 5000; ++i) names.emplace("name-" + std::to_string(i));
+  EXPECT_TRUE(names.contains(std::string_view("name-42")));
+  EXPECT_EQ(names.find(std::string_view("name-4999"))->back(), '9');
+  EXPECT_FALSE(names.contains(std::string_view("name-5000")));
+  EXPECT_EQ(names.erase("name-7"), 1);
+  EXPECT_FALSE(names.contains("name-7"));
+  EXPECT_EQ(names.size(), 4999);
+}
+
+TEST(flat_hash_set, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  using Alloc = std::pmr::polymorphic_allocator<std::pmr::string>;
+  using Set = s21::flat_hash_set<std::pmr::string, std::hash<std::pmr::string>,
+                                 std::equal_to<std::pmr::string>, Alloc>;
+  Set set(&resource);
+  for (int i = 0; i < 100; ++i)
+    set.insert(std::pmr::string("a string well beyond the small buffer " +
+                                std::to_string(i)));
+  EXPECT_EQ(set.begin()->get_allocator().resource(), &resource);
+  std::pmr::monotonic_buffer_resource other_resource;
+  Set other(&other_resource);
+  other = std::move(set);
+  EXPECT_EQ(other.size(), 100);
+  EXPECT_EQ(other.begin()->get_allocator().resource(), &other_resource);
+}
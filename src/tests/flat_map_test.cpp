@@ -0,0 +1,119 @@
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test.h"
+
+template class s21::flat_map<int, int>;
+
+TEST(flat_map, InsertAtAndSubscript) {
+  s21::flat_map<int, int> m;
+  for (int i = 0; i < 1000; ++i) m.insert((i * 31) % 1000, i);
+  EXPECT_EQ(m.size(), 1000);
+  EXPECT_EQ(m.at(31), 1);
+  EXPECT_THROW(m.at(1000), std::out_of_range);
+  m[1000] = 7;
+  EXPECT_EQ(m.at(1000), 7);
+  EXPECT_FALSE(m.insert(5, 0).second);
+  EXPECT_FALSE(m.insert_or_assign(5, -5).second);
+  EXPECT_EQ(m[5], -5);
+  EXPECT_TRUE(m.insert_or_assign(2000, 1).second);
+  EXPECT_EQ(m.size(), 1002);
+  EXPECT_EQ(m.keys().Size(), m.values().Size());
+}
+
+TEST(flat_map, IteratorsPairKeysWithValues) {
+  s21::flat_map<int, std::string> m({{3, "c"}, {1, "a"}, {2, "b"}});
+  std::string joined;
+  for (auto [key, value] : m) joined += std::to_string(key) + value;
+  EXPECT_EQ(joined, "1a2b3c");
+  auto it = m.find(2);
+  it->second += "!";
+  (*it).second += "?";
+  EXPECT_EQ(m.at(2), "b!?");
+  EXPECT_EQ((it + 1)->first, 3);
+  EXPECT_EQ(it[-1].second, "a");
+  EXPECT_EQ(m.end() - m.begin(), 3);
+  const auto &view = m;
+  s21::flat_map<int, std::string>::const_iterator cit = m.begin();
+  EXPECT_EQ(cit, view.begin());
+  EXPECT_EQ(view.nth_element(2)->second, "c");
+}
+
+TEST(flat_map, StringValuesMatchStdMap) {
+  s21::flat_map<int, std::string> m;
+  std::map<int, std::string> expected;
+  for (int i = 0; i < 2000; ++i) {
+    const int key = (i * 7919) % 2000;
+    const std::string value = "value number " + std::to_string(key);
+    m.insert(key, value);
+    expected.emplace(key, value);
+  }
+  for (int i = 0; i < 2000; i += 3) {
+    EXPECT_EQ(m.erase(i), expected.erase(i));
+  }
+  ASSERT_EQ(m.size(), expected.size());
+  auto it = m.begin();
+  for (const auto &[key, value] : expected) {
+    EXPECT_EQ(it->first, key);
+    EXPECT_EQ(it->second, value);
+    ++it;
+  }
+}
+
+TEST(flat_map, BatchInsertKeepsExistingAndFirstOfBatch) {
+  s21::flat_map<int, std::string> m({{2, "old"}, {4, "old"}});
+  std::vector<std::pair<int, std::string>> batch = {
+      {5, "first"}, {2, "new"}, {1, "first"}, {5, "second"}, {3, "first"}};
+  m.insert(batch.begin(), batch.end());
+  EXPECT_EQ(m.size(), 5);
+  EXPECT_EQ(m.at(1), "first");
+  EXPECT_EQ(m.at(2), "old");
+  EXPECT_EQ(m.at(5), "first");
+  m.insert_many(std::pair<int, std::string>(0, "zero"),
+                std::pair<int, std::string>(6, "six"));
+  EXPECT_EQ(m.begin()->second, "zero");
+  EXPECT_EQ(m.rank(6), 6);
+  EXPECT_EQ(m.count_range(1, 4), 3);
+}
+
+TEST(flat_map, BoundsAndTransparentLookup) {
+  s21::flat_map<std::string, int, std::less<>> m(
+      {{"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}});
+  EXPECT_EQ(m.lower_bound("b")->first, "bravo");
+  EXPECT_EQ(m.upper_bound("charlie")->first, "delta");
+  EXPECT_EQ(m.find(std::string_view("charlie"))->second, 3);
+  EXPECT_TRUE(m.contains(std::string_view("alpha")));
+  EXPECT_EQ(m.count("echo"), 0);
+  EXPECT_TRUE(m.value_comp()({"alpha", 0}, {"bravo", 0}));
+}
+
+TEST(flat_map, CopyAssignAndMergeKeepCollisionsInSource) {
+  s21::flat_map<int, std::string> target({{1, "a"}, {2, "b"}});
+  s21::flat_map<int, std::string> source({{2, "x"}, {3, "c"}});
+  s21::flat_map<int, std::string> copy;
+  copy = target;
+  target.merge(source);
+  EXPECT_EQ(target.size(), 3);
+  EXPECT_EQ(target.at(2), "b");
+  EXPECT_EQ(source.size(), 1);
+  EXPECT_EQ(source.at(2), "x");
+  EXPECT_EQ(copy.size(), 2);
+  copy = std::move(target);
+  EXPECT_EQ(copy.at(3), "c");
+}
+
+TEST(flat_map, Allocator_PropagatesToKeysAndValues) {
+  using entry = std::pair<std::pmr::string, std::pmr::string>;
+  std::pmr::monotonic_buffer_resource resource;
+  s21::flat_map<std::pmr::string, std::pmr::string, std::less<>,
+                std::pmr::polymorphic_allocator<entry>>
+      m(&resource);
+  m.insert(std::pmr::string("a key well beyond the small buffer"),
+           std::pmr::string("a value well beyond the small buffer"));
+  EXPECT_EQ(m.begin()->first.get_allocator().resource(), &resource);
+  EXPECT_EQ(m.begin()->second.get_allocator().resource(), &resource);
+  EXPECT_EQ(m.get_allocator().resource(), &resource);
+}
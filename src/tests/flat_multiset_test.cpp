@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "test.h"
+
+template class s21::flat_multiset<int>;
+
+TEST(flat_multiset, KeepsDuplicatesInOrder) {
+  s21::flat_multiset<int> ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    ms.insert(i % 17);
+    expected.insert(i % 17);
+  }
+  EXPECT_EQ(ms.size(), expected.size());
+  EXPECT_TRUE(std::equal(ms.begin(), ms.end(), expected.begin()));
+  for (int key = -1; key <= 17; ++key) {
+    EXPECT_EQ(ms.count(key), expected.count(key));
+    auto range = ms.equal_range(key);
+    EXPECT_EQ(static_cast<std::size_t>(range.second - range.first),
+              expected.count(key));
+  }
+  EXPECT_EQ(ms.erase(5), expected.erase(5));
+  EXPECT_FALSE(ms.contains(5));
+  EXPECT_EQ(ms.rank(6), ms.count_range(0, 6));
+}
+
+TEST(flat_multiset, BatchInsertIsStable) {
+  struct ByTens {
+    bool operator()(int a, int b) const { return a / 10 < b / 10; }
+  };
+  s21::flat_multiset<int, ByTens> ms({11, 21});
+  std::vector<int> batch = {29, 12, 3, 25, 13};
+  ms.insert(batch.begin(), batch.end());
+  EXPECT_EQ(std::vector<int>(ms.begin(), ms.end()),
+            (std::vector<int>{3, 11, 12, 13, 21, 29, 25}));
+  ms.insert_many(14, 1);
+  EXPECT_EQ(std::vector<int>(ms.begin(), ms.end()),
+            (std::vector<int>{3, 1, 11, 12, 13, 14, 21, 29, 25}));
+}
+
+TEST(flat_multiset, SortedBuildAndMerge) {
+  std::vector<int> keys = {1, 1, 2, 3, 3, 3};
+  auto ms = s21::flat_multiset<int>::from_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(ms.size(), 6);
+  s21::flat_multiset<int> other({3, 0, 2});
+  ms.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(std::vector<int>(ms.begin(), ms.end()),
+            (std::vector<int>{0, 1, 1, 2, 2, 3, 3, 3, 3}));
+  EXPECT_EQ(ms.count(3), 4);
+}
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <memory_resource>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "test.h"
+
+template class s21::flat_set<int>;
+
+namespace {
+template <typename Set>
+std::vector<int> Items(const Set &set) {
+  return std::vector<int>(set.begin(), set.end());
+}
+
+// Throws from the armed-th comparison, to fail a merge halfway through.
+struct Fragile {
+  static inline int armed = 0;
+  bool operator()(int a, int b) const {
+    if (armed > 0 && --armed == 0) throw std::runtime_error("compare");
+    return a < b;
+  }
+};
+}  // namespace
+
+TEST(flat_set, InsertFindAndOrder) {
+  s21::flat_set<int> set;
+  std::set<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    const int key = (i * 7919) % 2000;
+    auto result = set.insert(key);
+    EXPECT_EQ(result.second, expected.insert(key).second);
+    EXPECT_EQ(*result.first, key);
+  }
+  EXPECT_EQ(set.size(), expected.size());
+  EXPECT_EQ(Items(set), std::vector<int>(expected.begin(), expected.end()));
+  EXPECT_TRUE(set.contains(1999));
+  EXPECT_FALSE(set.contains(2000));
+  EXPECT_EQ(*set.find(1234), 1234);
+  EXPECT_EQ(set.find(-5), set.end());
+}
+
+TEST(flat_set, BinarySearchMatchesStdBounds) {
+  for (int n = 0; n < 40; ++n) {
+    std::vector<int> keys;
+    for (int i = 0; i < n; ++i) keys.push_back(i / 3 * 2);
+    for (int key = -1; key <= n; ++key) {
+      EXPECT_EQ(FlatTree::lower_index(keys.data(), keys.size(), key,
+                                      std::less<int>()),
+                static_cast<std::size_t>(
+                    std::lower_bound(keys.begin(), keys.end(), key) -
+                    keys.begin()));
+      EXPECT_EQ(FlatTree::upper_index(keys.data(), keys.size(), key,
+                                      std::less<int>()),
+                static_cast<std::size_t>(
+                    std::upper_bound(keys.begin(), keys.end(), key) -
+                    keys.begin()));
+    }
+  }
+}
+
+TEST(flat_set, BatchInsertSortsMergesAndDeduplicates) {
+  s21::flat_set<int> set({10, 20, 30});
+  std::vector<int> batch = {25, 5, 20, 35, 5, 15};
+  set.insert(batch.begin(), batch.end());
+  EXPECT_EQ(Items(set), (std::vector<int>{5, 10, 15, 20, 25, 30, 35}));
+  set.insert_many(40, 0, 10);
+  EXPECT_EQ(Items(set), (std::vector<int>{0, 5, 10, 15, 20, 25, 30, 35, 40}));
+  std::vector<int> tail = {50, 60};
+  set.insert(tail.begin(), tail.end());
+  EXPECT_EQ(set.size(), 11);
+  EXPECT_EQ(*(set.end() - 1), 60);
+}
+
+TEST(flat_set, RandomInsertEraseMatchesStdSet) {
+  s21::flat_set<int> set;
+  std::set<int> expected;
+  unsigned state = 7U;
+  for (int round = 0; round < 20000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 700U);
+    if ((state >> 8) % 3U == 0U) {
+      EXPECT_EQ(set.erase(key), expected.erase(key));
+    } else {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    }
+  }
+  EXPECT_EQ(Items(set), std::vector<int>(expected.begin(), expected.end()));
+  auto it = set.erase(set.lower_bound(100), set.lower_bound(200));
+  EXPECT_GE(*it, 200);
+  EXPECT_EQ(set.count_range(100, 200), 0);
+  while (!set.empty()) set.erase(set.begin());
+  EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST(flat_set, BoundsAndOrderStatistics) {
+  s21::flat_set<int> set;
+  for (int i = 0; i < 200; i += 2) set.insert(i);
+  EXPECT_EQ(*set.lower_bound(51), 52);
+  EXPECT_EQ(*set.upper_bound(52), 54);
+  EXPECT_EQ(set.lower_bound(199), set.end());
+  auto range = set.equal_range(10);
+  EXPECT_EQ(*range.first, 10);
+  EXPECT_EQ(*range.second, 12);
+  EXPECT_EQ(set.count(10), 1);
+  EXPECT_EQ(set.count(11), 0);
+  EXPECT_EQ(*set.nth_element(25), 50);
+  EXPECT_EQ(set.nth_element(100), set.end());
+  EXPECT_EQ(set.rank(51), 26);
+  EXPECT_EQ(set.count_range(10, 20), 5);
+  EXPECT_EQ(set.count_range(20, 10), 0);
+}
+
+TEST(flat_set, CopyMoveSwapAndMerge) {
+  s21::flat_set<int> original({5, 1, 3});
+  s21::flat_set<int> copy(original);
+  copy.erase(1);
+  EXPECT_TRUE(original.contains(1));
+  s21::flat_set<int> moved(std::move(copy));
+  EXPECT_EQ(Items(moved), (std::vector<int>{3, 5}));
+  moved = original;
+  EXPECT_EQ(Items(moved), (std::vector<int>{1, 3, 5}));
+  s21::flat_set<int> source({2, 3, 4, 5, 6});
+  moved.merge(source);
+  EXPECT_EQ(Items(moved), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(Items(source), (std::vector<int>{3, 5}));
+  moved.swap(source);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(source.size(), 6);
+}
+
+TEST(flat_set, StatefulComparatorAndTransparentLookup) {
+  s21::flat_set<int, std::greater<int>> desc({1, 4, 2, 3});
+  EXPECT_EQ(Items(desc), (std::vector<int>{4, 3, 2, 1}));
+  EXPECT_EQ(*desc.lower_bound(3), 3);
+  s21::flat_set<std::string, std::less<>> names;
+  for (int i = 0; i < 100; ++i) names.insert("name-" + std::to_string(i));
+  EXPECT_TRUE(names.contains(std::string_view("name-42")));
+  EXPECT_EQ(names.find(std::string_view("name-99"))->back(), '9');
+  EXPECT_FALSE(names.contains(std::string_view("name-100")));
+}
+
+TEST(flat_set, ThrowingComparisonDuringMergeLeavesSetValid) {
+  s21::flat_set<int, Fragile> set({1, 2, 3});
+  std::vector<int> batch = {0, 4};
+  Fragile::armed = 3;
+  EXPECT_THROW(set.insert(batch.begin(), batch.end()), std::runtime_error);
+  Fragile::armed = 0;
+  EXPECT_TRUE(std::is_sorted(set.begin(), set.end()));
+  set.insert(7);
+  EXPECT_TRUE(set.contains(7));
+}
+
+TEST(flat_set, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::flat_set<std::pmr::string, std::less<>,
+                std::pmr::polymorphic_allocator<std::pmr::string>>
+      set(&resource);
+  set.insert(std::pmr::string("a string well beyond the small buffer"));
+  EXPECT_EQ(set.begin()->get_allocator().resource(), &resource);
+  EXPECT_EQ(set.get_allocator().resource(), &resource);
+}
@@ -1,4 +1,7 @@
 #include <list>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
 
 #include "test.h"
 
@@ -53,6 +56,27 @@ TEST(List, Constructor_Move) {
   EXPECT_EQ(our_list.Empty(), std_list.empty());
 }
 
+TEST(List, Constructor_Move_TakesSentinel) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::List<int>>);
+  s21::List<int> our_list({1, 2, 3});
+  const auto end = our_list.End();
+  s21::List<int> our_copy(std::move(our_list));
+  EXPECT_TRUE(our_copy.End() == end);
+  EXPECT_EQ(*--our_copy.End(), 3);
+  EXPECT_TRUE(our_list.Empty());
+  EXPECT_TRUE(our_list.Begin() == our_list.End());
+  our_list.Push_Back(5);
+  our_list.Push_Front(4);
+  EXPECT_EQ(*--our_list.End(), 5);
+  int sum = 0;
+  for (auto it = our_list.Begin(); it != our_list.End(); ++it) sum += *it;
+  EXPECT_EQ(sum, 9);
+  s21::List<int> empty;
+  s21::List<int> moved_empty(std::move(empty));
+  moved_empty.Push_Back(1);
+  EXPECT_EQ(moved_empty.Back(), 1);
+}
+
 TEST(List, Operator_Move) {
   s21::List<int> our_list({1, 2, 3});
   std::list<int> std_list({1, 2, 3});
@@ -409,3 +433,86 @@ TEST(List, ListIterator) {
   --it;
   EXPECT_EQ(*it, 1);
 }
+
+TEST(List, Emplace_Back_Front) {
+  s21::List<std::pair<std::string, int>> our_list;
+  auto &back = our_list.Emplace_Back("b", 2);
+  EXPECT_EQ(back.second, 2);
+  our_list.Emplace_Front("a", 1);
+  our_list.Emplace_Back("c", 3);
+  EXPECT_EQ(our_list.Size(), 3);
+  EXPECT_EQ(our_list.Front().first, "a");
+  EXPECT_EQ(our_list.Back().first, "c");
+}
+
+TEST(List, Emplace_Middle) {
+  s21::List<std::string> our_list({"a", "c"});
+  s21::List<std::string>::const_iterator pos = our_list.Cbegin();
+  ++pos;
+  auto it = our_list.Emplace(pos, 1, 'b');
+  EXPECT_EQ(*it, "b");
+  std::string joined;
+  for (auto cur = our_list.Begin(); cur != our_list.End(); ++cur) {
+    joined += *cur;
+  }
+  EXPECT_EQ(joined, "abc");
+  our_list.Emplace(our_list.Cend(), "d");
+  EXPECT_EQ(our_list.Back(), "d");
+}
+
+TEST(List, Push_Back_Rvalue) {
+  s21::List<std::string> our_list;
+  std::string value(64, 'x');
+  our_list.Push_Back(std::move(value));
+  our_list.Push_Front(std::string(8, 'y'));
+  EXPECT_EQ(our_list.Back(), std::string(64, 'x'));
+  EXPECT_EQ(our_list.Front(), std::string(8, 'y'));
+  EXPECT_EQ(our_list.Size(), 2);
+}
+
+TEST(List, Allocator_NodesComeFromResource) {
+  alignas(std::max_align_t) unsigned char buf[4096];
+  std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf),
+                                            std::pmr::null_memory_resource());
+  s21::List<int, std::pmr::polymorphic_allocator<int>> our_list(&arena);
+  for (int i = 0; i < 32; ++i) our_list.Push_Back(i);
+  const auto* front = reinterpret_cast<const unsigned char*>(&our_list.Front());
+  EXPECT_TRUE(front >= buf && front < buf + sizeof(buf));
+  EXPECT_EQ(our_list.Get_Allocator().resource(), &arena);
+  our_list.Clear();
+  our_list.Push_Front(7);
+  EXPECT_EQ(our_list.Back(), 7);
+}
+
+TEST(List, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  s21::List<std::pmr::string,
+            std::pmr::polymorphic_allocator<std::pmr::string>>
+      a(&first);
+  s21::List<std::pmr::string,
+            std::pmr::polymorphic_allocator<std::pmr::string>>
+      b(&second);
+  a.Emplace_Back(64, 'x');
+  EXPECT_EQ(a.Front().get_allocator().resource(), &first);
+  b = std::move(a);
+  EXPECT_EQ(b.Get_Allocator().resource(), &second);
+  EXPECT_EQ(b.Front().get_allocator().resource(), &second);
+  EXPECT_EQ(b.Front(), std::pmr::string(64, 'x'));
+}
+
+TEST(List, Refill_After_Erasing_All) {
+  s21::List<int> our_list;
+  for (int round = 0; round < 3; ++round) {
+    for (int i = 0; i < 5; ++i) our_list.Push_Back(i);
+    our_list.Pop_Back();
+    for (int i = 0; i < 4; ++i) our_list.Pop_Front();
+    EXPECT_TRUE(our_list.Empty());
+  }
+  our_list.Push_Back(1);
+  our_list.Push_Front(0);
+  our_list.Push_Back(2);
+  EXPECT_EQ(our_list.Front(), 0);
+  EXPECT_EQ(our_list.Back(), 2);
+  EXPECT_EQ(our_list.Size(), 3);
+}
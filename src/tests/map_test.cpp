@@ -1,4 +1,8 @@
 #include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "test.h"
 
@@ -457,3 +461,182 @@ TEST(map, InsertMany) {
   EXPECT_EQ(m1.contains(2), true);
   EXPECT_EQ(m1.contains(4), true);
 }
+
+TEST(map, Allocator_PropagatesToElements) {
+  using pmr_map =
+      s21::map<int, std::pmr::string, std::less<int>,
+               std::pmr::polymorphic_allocator<
+                   std::pair<const int, std::pmr::string>>>;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  pmr_map a(&first);
+  a.insert(1, std::pmr::string(48, 'q'));
+  EXPECT_EQ(a.at(1).get_allocator().resource(), &first);
+  pmr_map b(&second);
+  b = std::move(a);
+  EXPECT_EQ(b.get_allocator().resource(), &second);
+  EXPECT_EQ(b.at(1).get_allocator().resource(), &second);
+  EXPECT_EQ(b.at(1), std::pmr::string(48, 'q'));
+}
+
+TEST(map, ClearLargeAndReuse) {
+  s21::map<int, int> m;
+  for (int i = 0; i < 10000; ++i) m.insert(i, i * 2);
+  m.clear();
+  EXPECT_TRUE(m.empty());
+  EXPECT_EQ(m.size(), 0);
+  EXPECT_TRUE(m.begin() == m.end());
+  m.insert(5, 10);
+  EXPECT_EQ(m.at(5), 10);
+  EXPECT_EQ(m.size(), 1);
+}
+
+TEST(map, CopyKeepsShapeAndOrder) {
+  s21::map<int, int> original;
+  for (int i = 0; i < 1000; ++i) original.insert((i * 37) % 1000, i);
+  s21::map<int, int> copy(original);
+  ASSERT_EQ(copy.size(), original.size());
+  auto it = original.begin();
+  for (auto cit = copy.begin(); cit != copy.end(); ++cit, ++it) {
+    EXPECT_EQ((*cit).first, (*it).first);
+    EXPECT_EQ((*cit).second, (*it).second);
+    EXPECT_NE(cit.node_, it.node_);
+    EXPECT_EQ(cit.node_->red_, it.node_->red_);
+  }
+  copy.erase(copy.find(500));
+  EXPECT_TRUE(original.contains(500));
+  s21::map<int, int> assigned;
+  assigned.insert(-1, -1);
+  assigned = original;
+  EXPECT_EQ(assigned.size(), 1000);
+  EXPECT_FALSE(assigned.contains(-1));
+}
+
+TEST(map, RangeConstructorKeepsFirstDuplicate) {
+  std::vector<std::pair<int, std::string>> items = {
+      {3, "c"}, {1, "a"}, {3, "x"}, {2, "b"}};
+  s21::map<int, std::string> m(items.begin(), items.end());
+  std::map<int, std::string> expected(items.begin(), items.end());
+  ASSERT_EQ(m.size(), expected.size());
+  for (const auto &[key, value] : expected) EXPECT_EQ(m.at(key), value);
+}
+
+TEST(map, FromSortedMap) {
+  std::map<int, int> source;
+  for (int i = 0; i < 1000; ++i) source[i] = -i;
+  auto m = s21::map<int, int>::from_sorted(source.begin(), source.end());
+  EXPECT_EQ(m.size(), 1000);
+  EXPECT_EQ(m.at(999), -999);
+  m[1000] = 1;
+  m.erase(m.find(0));
+  EXPECT_EQ(m.size(), 1000);
+}
+
+TEST(map, ExtractMovesEntry) {
+  s21::map<int, std::string> m1({{1, "one"}, {2, "two"}});
+  s21::map<int, std::string> m2;
+  auto handle = m1.extract(2);
+  ASSERT_TRUE(handle);
+  handle.value().second = "deux";
+  auto result = m2.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_EQ(m2.at(2), "deux");
+  EXPECT_FALSE(m1.contains(2));
+  m1.merge(m2);
+  EXPECT_EQ(m1.size(), 2);
+  EXPECT_TRUE(m2.empty());
+}
+
+namespace {
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) {}
+  int value;
+};
+
+struct CountedDefault {
+  CountedDefault() { ++constructed; }
+  static int constructed;
+};
+int CountedDefault::constructed = 0;
+}  // namespace
+
+TEST(map, LookupWithoutDefaultConstructibleValue) {
+  s21::map<int, NoDefault> m;
+  m.insert(1, NoDefault(10));
+  m.insert(2, NoDefault(20));
+  EXPECT_EQ(m.at(2).value, 20);
+  EXPECT_EQ((*m.find(1)).second.value, 10);
+  EXPECT_TRUE(m.contains(1));
+  EXPECT_FALSE(m.contains(3));
+  EXPECT_THROW(m.at(3), std::out_of_range);
+  EXPECT_TRUE(m.extract(1));
+}
+
+TEST(map, SubscriptConstructsValueOnlyOnInsert) {
+  s21::map<int, CountedDefault> m;
+  CountedDefault::constructed = 0;
+  m[1];
+  EXPECT_EQ(CountedDefault::constructed, 1);
+  m[1];
+  m.at(1);
+  m.find(1);
+  m.contains(2);
+  EXPECT_EQ(CountedDefault::constructed, 1);
+  EXPECT_EQ(m.size(), 1);
+}
+
+TEST(map, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> m;
+  m.insert("apple", 1);
+  m.insert("banana-and-a-long-suffix", 2);
+  std::string_view key = "banana-and-a-long-suffix";
+  EXPECT_EQ((*m.find(key)).second, 2);
+  EXPECT_TRUE(m.contains(std::string_view("apple")));
+  EXPECT_TRUE(m.contains("apple"));
+  EXPECT_FALSE(m.contains(std::string_view("cherry")));
+  EXPECT_EQ(m.find(std::string_view("cherry")), m.end());
+  const auto &cm = m;
+  EXPECT_EQ((*cm.find(key)).first, "banana-and-a-long-suffix");
+}
+
+TEST(map, StatefulComparatorAndValueComp) {
+  auto by_length = [](const std::string &a, const std::string &b) {
+    return a.size() < b.size();
+  };
+  s21::map<std::string, int, decltype(by_length)> m(by_length);
+  m.insert("ccc", 3);
+  m.insert("a", 1);
+  m.insert("bb", 2);
+  m.insert("zz", 20);
+  EXPECT_EQ(m.size(), 3);
+  EXPECT_EQ(m.at("xx"), 2);
+  EXPECT_EQ((*m.begin()).first, "a");
+  auto value_comp = m.value_comp();
+  EXPECT_TRUE(value_comp(*m.begin(), *m.find("ccc")));
+  EXPECT_FALSE(m.key_comp()("ab", "cd"));
+}
+
+TEST(map, BoundsAndCount) {
+  s21::map<int, std::string> m({{10, "a"}, {20, "b"}, {30, "c"}});
+  EXPECT_EQ((*m.lower_bound(20)).second, "b");
+  EXPECT_EQ((*m.upper_bound(20)).second, "c");
+  EXPECT_EQ((*m.lower_bound(11)).first, 20);
+  EXPECT_EQ(m.upper_bound(30), m.end());
+  auto range = m.equal_range(25);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(m.count(10), 1);
+  EXPECT_EQ(m.count(15), 0);
+  const auto &cm = m;
+  EXPECT_EQ((*cm.lower_bound(0)).first, 10);
+}
+
+TEST(map, OrderStatistics) {
+  s21::map<std::string, int> m(
+      {{"delta", 4}, {"alpha", 1}, {"charlie", 3}, {"bravo", 2}});
+  EXPECT_EQ((*m.nth_element(2)).first, "charlie");
+  EXPECT_EQ(m.rank("charlie"), 2);
+  EXPECT_EQ(m.rank("c"), 2);
+  EXPECT_EQ(m.count_range("b", "d"), 2);
+  const auto &cm = m;
+  EXPECT_EQ((*cm.nth_element(3)).second, 4);
+}
@@ -0,0 +1,162 @@
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+
+template class s21::mpmc_queue<int>;
+
+namespace {
+// Counts live instances, to check that leftovers are destroyed.
+struct Counted {
+  static inline int live = 0;
+  explicit Counted(int v) noexcept : value(v) { ++live; }
+  Counted(const Counted &other) noexcept : value(other.value) { ++live; }
+  Counted &operator=(const Counted &) = default;
+  ~Counted() { --live; }
+  int value;
+};
+
+// Copies without throwing but may throw when moved, so a value built ahead
+// of the claim has to be copied into the cell.
+struct ThrowingMove {
+  explicit ThrowingMove(int v) noexcept : value(v) {}
+  ThrowingMove(const ThrowingMove &other) noexcept : value(other.value) {}
+  ThrowingMove(ThrowingMove &&other) noexcept(false) : value(other.value) {}
+  ThrowingMove &operator=(const ThrowingMove &) = default;
+  int value;
+};
+}  // namespace
+
+TEST(MpmcQueue, TryPushAndPopInOrder) {
+  s21::mpmc_queue<int> queue(5);
+  EXPECT_EQ(queue.capacity(), 8);
+  EXPECT_TRUE(queue.empty());
+  int out = -1;
+  EXPECT_FALSE(queue.try_pop(out));
+  for (int round = 0; round < 5; ++round) {
+    for (int i = 0; i < 8; ++i) EXPECT_TRUE(queue.try_push(round * 10 + i));
+    EXPECT_FALSE(queue.try_push(-1));
+    EXPECT_EQ(queue.size(), 8);
+    for (int i = 0; i < 8; ++i) {
+      EXPECT_TRUE(queue.try_pop(out));
+      EXPECT_EQ(out, round * 10 + i);
+    }
+    EXPECT_TRUE(queue.empty());
+  }
+  EXPECT_THROW(s21::mpmc_queue<int>(0), std::length_error);
+}
+
+TEST(MpmcQueue, MoveOnlyValuesAndLeftoversAreDestroyed) {
+  {
+    s21::mpmc_queue<std::unique_ptr<int>> queue(4);
+    queue.push(std::make_unique<int>(1));
+    EXPECT_TRUE(queue.try_emplace(new int(2)));
+    std::unique_ptr<int> out;
+    queue.pop(out);
+    EXPECT_EQ(*out, 1);
+  }
+  {
+    s21::mpmc_queue<Counted> queue(4);
+    queue.emplace(1);
+    queue.emplace(2);
+    Counted out(0);
+    queue.pop(out);
+    EXPECT_EQ(out.value, 1);
+    EXPECT_EQ(Counted::live, 2);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(MpmcQueue, ManyProducersAndConsumersDeliverEachValueOnce) {
+  constexpr int kThreads = 4;
+  constexpr int kPerProducer = 20000;
+  s21::mpmc_queue<int> queue(64);
+  std::vector<std::vector<int>> received(kThreads);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kThreads; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kPerProducer; ++i) queue.push(p * kPerProducer + i);
+    });
+  }
+  for (int c = 0; c < kThreads; ++c) {
+    threads.emplace_back([&queue, &received, c] {
+      for (int i = 0; i < kPerProducer; ++i) {
+        int value = 0;
+        queue.pop(value);
+        received[c].push_back(value);
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::vector<int> seen(kThreads * kPerProducer, 0);
+  bool ordered = true;
+  for (const auto &values : received) {
+    std::vector<int> last(kThreads, -1);
+    for (int value : values) {
+      ++seen[value];
+      ordered &= value > last[value / kPerProducer];
+      last[value / kPerProducer] = value;
+    }
+  }
+  EXPECT_TRUE(ordered);
+  EXPECT_EQ(std::count(seen.begin(), seen.end(), 1),
+            static_cast<long>(seen.size()));
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueue, BlockedPushAndPopParkAndWake) {
+  s21::mpmc_queue<std::string> queue(2);
+  std::atomic<int> pushed{0};
+  std::thread producer([&queue, &pushed] {
+    for (int i = 0; i < 6; ++i) {
+      queue.push(std::to_string(i));
+      ++pushed;
+    }
+  });
+  while (pushed.load() < 2) std::this_thread::yield();
+  for (int i = 0; i < 100; ++i) std::this_thread::yield();
+  EXPECT_EQ(pushed.load(), 2);  // the third push stays parked
+  std::string out;
+  for (int i = 0; i < 6; ++i) {
+    queue.pop(out);
+    EXPECT_EQ(out, std::to_string(i));
+  }
+  producer.join();
+  std::thread consumer([&queue, &out] { queue.pop(out); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  queue.push("late");
+  consumer.join();
+  EXPECT_EQ(out, "late");
+}
+
+TEST(MpmcQueue, NothrowCopyWithThrowingMove) {
+  s21::mpmc_queue<ThrowingMove> queue(4);
+  EXPECT_TRUE(queue.try_push(ThrowingMove(2)));
+  EXPECT_TRUE(queue.try_emplace(3));
+  queue.push(ThrowingMove(4));
+  queue.emplace(5);
+  ThrowingMove out(0);
+  for (int i = 2; i <= 5; ++i) {
+    EXPECT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out.value, i);
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueue, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::mpmc_queue<std::pmr::string,
+                  std::pmr::polymorphic_allocator<std::pmr::string>>
+      queue(4, &resource);
+  queue.push(std::pmr::string("a string well beyond the small buffer"));
+  std::pmr::string out(&resource);
+  queue.pop(out);
+  EXPECT_EQ(out, "a string well beyond the small buffer");
+  EXPECT_EQ(queue.get_allocator().resource(), &resource);
+}
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <memory_resource>
 #include <set>
+#include <vector>
 
 #include "test.h"
 
@@ -319,3 +322,148 @@ TEST(multiset, MaxSize) {
   s21::multiset<int> ms2({1, 1, 1, 2, 3, 3, 4, 5, 5});
   EXPECT_EQ(ms1.max_size(), ms2.max_size());
 }
+
+TEST(multiset, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::multiset<std::pmr::string, std::less<std::pmr::string>,
+                std::pmr::polymorphic_allocator<std::pmr::string>>
+      ms(&arena);
+  ms.insert(std::pmr::string(40, 'a'));
+  ms.insert(std::pmr::string(40, 'a'));
+  EXPECT_EQ(ms.size(), 2);
+  EXPECT_EQ((*ms.begin()).get_allocator().resource(), &arena);
+  auto copy(ms);
+  EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(copy.size(), 2);
+}
+
+TEST(multiset, SortedDuplicatesStayOrdered) {
+  s21::multiset<int> ms;
+  for (int i = 0; i < 10000; ++i) ms.insert(i / 4);
+  EXPECT_EQ(ms.size(), 10000);
+  EXPECT_EQ(ms.count(1234), 4);
+  int previous = -1;
+  for (auto it = ms.begin(); it != ms.end(); ++it) {
+    EXPECT_LE(previous, *it);
+    previous = *it;
+  }
+}
+
+TEST(multiset, CopyKeepsDuplicates) {
+  s21::multiset<int> ms;
+  for (int i = 0; i < 300; ++i) ms.insert(i % 7);
+  s21::multiset<int> copy(ms);
+  EXPECT_EQ(copy.size(), 300);
+  for (int k = 0; k < 7; ++k) EXPECT_EQ(copy.count(k), ms.count(k));
+}
+
+TEST(multiset, RangeConstructorKeepsDuplicates) {
+  std::vector<int> keys = {4, 1, 4, 2, 4, 1};
+  s21::multiset<int> ms(keys.begin(), keys.end());
+  EXPECT_EQ(ms.size(), 6);
+  EXPECT_EQ(ms.count(4), 3);
+  EXPECT_EQ(ms.count(1), 2);
+  auto sorted = s21::multiset<int>::from_sorted(ms.begin(), ms.end());
+  EXPECT_EQ(sorted.size(), 6);
+  EXPECT_EQ(*sorted.begin(), 1);
+}
+
+TEST(multiset, MergeSplicesDuplicates) {
+  s21::multiset<int> ms1({1, 2, 2});
+  s21::multiset<int> ms2({2, 3});
+  const int* three = &*ms2.find(3);
+  ms1.merge(ms2);
+  EXPECT_EQ(ms1.size(), 5);
+  EXPECT_TRUE(ms2.empty());
+  EXPECT_EQ(ms1.count(2), 3);
+  EXPECT_EQ(&*ms1.find(3), three);
+  auto handle = ms1.extract(2);
+  EXPECT_EQ(ms1.count(2), 2);
+  ms1.insert(std::move(handle));
+  EXPECT_EQ(ms1.count(2), 3);
+}
+
+namespace {
+struct Order {
+  int id;
+  int quantity;
+};
+
+struct ById {
+  using is_transparent = void;
+  bool operator()(const Order &a, const Order &b) const { return a.id < b.id; }
+  bool operator()(const Order &a, int id) const { return a.id < id; }
+  bool operator()(int id, const Order &b) const { return id < b.id; }
+};
+}  // namespace
+
+TEST(multiset, TransparentLookupById) {
+  s21::multiset<Order, ById> orders;
+  orders.insert({1, 10});
+  orders.insert({2, 5});
+  orders.insert({2, 7});
+  orders.insert({3, 1});
+  EXPECT_EQ(orders.count(2), 2);
+  EXPECT_EQ(orders.count(4), 0);
+  EXPECT_EQ((*orders.find(2)).quantity, 5);
+  EXPECT_TRUE(orders.contains(3));
+  EXPECT_FALSE(orders.contains(0));
+}
+
+TEST(multiset, StatefulComparator) {
+  auto modulo = [divisor = 10](int a, int b) {
+    return a % divisor < b % divisor;
+  };
+  s21::multiset<int, decltype(modulo)> ms({21, 1, 35, 11, 5}, modulo);
+  EXPECT_EQ(ms.count(31), 3);
+  EXPECT_EQ(*ms.begin(), 21);
+  EXPECT_TRUE(ms.key_comp()(10, 9));
+}
+
+TEST(multiset, CountHeavyDuplicates) {
+  s21::multiset<int> ms;
+  std::multiset<int> expected;
+  for (int i = 0; i < 30000; ++i) {
+    ms.insert(i % 5);
+    expected.insert(i % 5);
+  }
+  for (int i = 0; i < 10000; i += 2) {
+    ms.erase(ms.find(i % 3));
+    expected.erase(expected.find(i % 3));
+  }
+  for (int key = -1; key <= 5; ++key)
+    EXPECT_EQ(ms.count(key), expected.count(key));
+  auto range = ms.equal_range(3);
+  EXPECT_EQ(static_cast<std::size_t>(std::distance(range.first, range.second)),
+            expected.count(3));
+}
+
+TEST(multiset, OrderStatistics) {
+  s21::multiset<int> ms;
+  std::vector<int> sorted;
+  unsigned state = 12345U;
+  for (int i = 0; i < 3000; ++i) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 500U);
+    ms.insert(key);
+    sorted.push_back(key);
+  }
+  for (int i = 0; i < 1000; ++i) {
+    ms.erase(ms.find(sorted[i]));
+  }
+  sorted.erase(sorted.begin(), sorted.begin() + 1000);
+  std::sort(sorted.begin(), sorted.end());
+  for (std::size_t k = 0; k < sorted.size(); k += 7)
+    EXPECT_EQ(*ms.nth_element(k), sorted[k]);
+  EXPECT_EQ(ms.nth_element(sorted.size()), ms.end());
+  for (int key = -1; key <= 501; key += 5) {
+    const auto lower = std::lower_bound(sorted.begin(), sorted.end(), key);
+    EXPECT_EQ(ms.rank(key), static_cast<std::size_t>(lower - sorted.begin()));
+    const auto upper =
+        std::lower_bound(sorted.begin(), sorted.end(), key + 40);
+    EXPECT_EQ(ms.count_range(key, key + 40),
+              static_cast<std::size_t>(upper - lower));
+  }
+  EXPECT_EQ(ms.count_range(300, 200), 0);
+  EXPECT_EQ(ms.count_range(-10, 1000), sorted.size());
+}
@@ -0,0 +1,132 @@
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+
+template class s21::PoolAllocator<int>;
+
+namespace {
+struct alignas(64) Wide {
+  char bytes[80];
+};
+}  // namespace
+
+TEST(NodePool, ReusesReleasedSlot) {
+  using pool = s21::NodePool<24, 8>;
+  void* first = pool::Allocate();
+  pool::Deallocate(first);
+  void* second = pool::Allocate();
+  EXPECT_EQ(first, second);
+  pool::Deallocate(second);
+}
+
+TEST(NodePool, DistinctSlots) {
+  using pool = s21::NodePool<40, 8>;
+  std::vector<void*> slots;
+  for (int i = 0; i < 5000; ++i) slots.push_back(pool::Allocate());
+  std::set<void*> unique(slots.begin(), slots.end());
+  EXPECT_EQ(unique.size(), slots.size());
+  for (void* p : slots) pool::Deallocate(p);
+}
+
+TEST(NodePool, OverAlignedSlots) {
+  s21::PoolAllocator<Wide> alloc;
+  std::vector<Wide*> items;
+  for (int i = 0; i < 100; ++i) items.push_back(alloc.allocate(1));
+  for (Wide* p : items) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % alignof(Wide), 0U);
+  }
+  for (Wide* p : items) alloc.deallocate(p, 1);
+}
+
+TEST(NodePool, ArraysBypassPool) {
+  s21::PoolAllocator<int> alloc;
+  int* arr = alloc.allocate(16);
+  for (int i = 0; i < 16; ++i) arr[i] = i;
+  EXPECT_EQ(arr[15], 15);
+  alloc.deallocate(arr, 16);
+}
+
+TEST(NodePool, AllocatorsCompareEqual) {
+  s21::PoolAllocator<int> a;
+  s21::PoolAllocator<double> b(a);
+  EXPECT_TRUE(a == b);
+  EXPECT_FALSE(a != b);
+}
+
+TEST(NodePool, ReleasedOnAnotherThread) {
+  s21::List<int> our_list;
+  std::thread producer([&our_list] {
+    for (int i = 0; i < 1000; ++i) our_list.Push_Back(i);
+  });
+  producer.join();
+  EXPECT_EQ(our_list.Size(), 1000);
+  EXPECT_EQ(our_list.Back(), 999);
+  our_list.Clear();
+  std::thread worker([] {
+    s21::set<int> local;
+    for (int i = 0; i < 1000; ++i) local.insert(i);
+    EXPECT_EQ(local.size(), 1000);
+  });
+  worker.join();
+  for (int i = 0; i < 1000; ++i) our_list.Push_Front(i);
+  EXPECT_EQ(our_list.Front(), 999);
+}
+
+TEST(NodePool, EmptyBlocksReturnToHeap) {
+  using pool = s21::NodePool<104, 8>;
+  std::vector<void*> slots;
+  for (int i = 0; i < 100000; ++i) slots.push_back(pool::Allocate());
+  EXPECT_GT(pool::Blocks(), 10U);
+  for (void* p : slots) pool::Deallocate(p);
+  EXPECT_LE(pool::Blocks(), 2U);  // the current block and one spare
+}
+
+TEST(NodePool, FreesFromConsumerThreadAreReused) {
+  using pool = s21::NodePool<112, 8>;
+  std::deque<void*> handoff;
+  std::mutex mutex;
+  const int total = 200000;
+  size_t peak_blocks = 0;
+  std::thread producer([&] {
+    for (int i = 0; i < total;) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (; i < total && handoff.size() < 1000; ++i)
+          handoff.push_back(pool::Allocate());
+        peak_blocks = std::max(peak_blocks, pool::Blocks());
+      }
+      std::this_thread::yield();
+    }
+  });
+  for (int freed = 0; freed < total;) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (; !handoff.empty(); ++freed) {
+        pool::Deallocate(handoff.front());
+        handoff.pop_front();
+      }
+    }
+    std::this_thread::yield();
+  }
+  producer.join();
+  EXPECT_LE(peak_blocks, 4U);
+  EXPECT_EQ(pool::Blocks(), 0U);  // the producer's blocks die with it
+}
+
+TEST(NodePool, OrphanedBlockFreedByLastRelease) {
+  using pool = s21::NodePool<120, 8>;
+  std::vector<void*> slots;
+  std::thread owner([&slots] {
+    for (int i = 0; i < 5000; ++i) slots.push_back(pool::Allocate());
+  });
+  owner.join();
+  EXPECT_GT(pool::Blocks(), 0U);
+  for (void* p : slots) pool::Deallocate(p);
+  EXPECT_EQ(pool::Blocks(), 0U);
+}
@@ -1,3 +1,4 @@
+#include <memory_resource>
 #include <queue>
 
 #include "test.h"
@@ -197,3 +198,34 @@ TEST(Queue, SwapThrow) {
   s21::stack<int> s({3, 2, 1});
   EXPECT_THROW(q.swap(s), std::invalid_argument);
 }
+
+TEST(Queue, Emplace) {
+  s21::queue<std::pair<std::string, int>> q;
+  q.emplace("first", 1);
+  q.push(std::make_pair(std::string("second"), 2));
+  EXPECT_EQ(q.size(), 2);
+  EXPECT_EQ(q.front().first, "first");
+  EXPECT_EQ(q.back().second, 2);
+}
+
+TEST(Queue, PushAfterDrain) {
+  s21::queue<int> q({1, 2});
+  q.pop();
+  q.pop();
+  EXPECT_TRUE(q.empty());
+  q.push(3);
+  EXPECT_EQ(q.front(), 3);
+  EXPECT_EQ(q.back(), 3);
+}
+
+TEST(Queue, Allocator_NodesComeFromResource) {
+  alignas(std::max_align_t) unsigned char buf[2048];
+  std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf),
+                                            std::pmr::null_memory_resource());
+  s21::queue<int, std::pmr::polymorphic_allocator<int>> q(&arena);
+  for (int i = 0; i < 16; ++i) q.push(i);
+  const auto* back = reinterpret_cast<const unsigned char*>(&q.back());
+  EXPECT_TRUE(back >= buf && back < buf + sizeof(buf));
+  EXPECT_EQ(q.get_allocator().resource(), &arena);
+  EXPECT_EQ(q.front(), 0);
+}
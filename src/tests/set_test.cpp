@@ -1,9 +1,53 @@
+#include <cmath>
+#include <memory_resource>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "test.h"
 
 template class s21::set<int>;
 
+namespace {
+template <typename NodePtr>
+std::size_t Weight(NodePtr node) {
+  return node == nullptr ? 0 : node->weight_;
+}
+
+// Checks the red-black rules and subtree sizes below node and returns its
+// black height, or -1 when a rule, a size or a parent link is broken.
+template <typename NodePtr>
+int BlackHeight(NodePtr node) {
+  if (node == nullptr) return 1;
+  for (auto child : {node->left_, node->right_}) {
+    if (child == nullptr) continue;
+    if (child->parent_ != node) return -1;
+    if (node->red_ && child->red_) return -1;
+  }
+  if (node->weight_ != Weight(node->left_) + Weight(node->right_) + 1)
+    return -1;
+  const int left = BlackHeight(node->left_);
+  const int right = BlackHeight(node->right_);
+  if (left < 0 || left != right) return -1;
+  return left + (node->red_ ? 0 : 1);
+}
+
+template <typename Iterator>
+bool IsRedBlack(Iterator first) {
+  auto root = first.node_;
+  if (root == nullptr) return true;
+  while (root->parent_ != nullptr) root = root->parent_;
+  return !root->red_ && BlackHeight(root) > 0;
+}
+
+template <typename Iterator>
+int Depth(Iterator it) {
+  int depth = 0;
+  for (auto node = it.node_; node != nullptr; node = node->parent_) ++depth;
+  return depth;
+}
+}  // namespace
+
 TEST(set, ConstructorDefaultSet) {
   s21::set<int> myEmptySet;
   std::set<int> origEmptySet;
@@ -236,3 +280,288 @@ TEST(set, InsertMany) {
   EXPECT_TRUE(s1.contains(5));
   EXPECT_TRUE(s1.contains(6));
 }
+
+TEST(set, Allocator_NodesComeFromResource) {
+  alignas(std::max_align_t) unsigned char buf[4096];
+  std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf),
+                                            std::pmr::null_memory_resource());
+  s21::set<int, std::less<int>, std::pmr::polymorphic_allocator<int>> s(
+      &arena);
+  for (int i = 0; i < 32; ++i) s.insert(i);
+  const auto* key = reinterpret_cast<const unsigned char*>(&*s.find(17));
+  EXPECT_TRUE(key >= buf && key < buf + sizeof(buf));
+  EXPECT_EQ(s.get_allocator().resource(), &arena);
+  s.erase(s.find(17));
+  EXPECT_FALSE(s.contains(17));
+  EXPECT_EQ(s.size(), 31);
+}
+
+TEST(set, SortedInsertStaysBalanced) {
+  const int n = 1 << 16;
+  s21::set<int> s;
+  for (int i = 0; i < n; ++i) s.insert(i);
+  EXPECT_TRUE(IsRedBlack(s.begin()));
+  int depth = 0;
+  for (auto it = s.begin(); it != s.end(); ++it) {
+    depth = std::max(depth, Depth(it));
+  }
+  EXPECT_LE(depth, 2 * std::log2(n + 1));
+  EXPECT_EQ(*s.find(n - 1), n - 1);
+}
+
+TEST(set, EraseKeepsRedBlackRules) {
+  s21::set<int> s;
+  for (int i = 0; i < 2000; ++i) s.insert((i * 7919) % 2000);
+  for (int i = 0; i < 2000; i += 3) {
+    s.erase(s.find((i * 31) % 2000));
+    ASSERT_TRUE(IsRedBlack(s.begin()));
+  }
+  int expected = 0;
+  for (int i = 0; i < 2000; ++i) expected += s.contains(i) ? 1 : 0;
+  EXPECT_EQ(static_cast<int>(s.size()), expected);
+  while (!s.empty()) {
+    s.erase(s.begin());
+    ASSERT_TRUE(IsRedBlack(s.begin()));
+  }
+}
+
+TEST(set, EraseKeepsOtherIterators) {
+  s21::set<int> s;
+  for (int i = 0; i < 64; ++i) s.insert(i);
+  auto target = s.find(31);
+  auto next = target;
+  ++next;
+  const int* next_address = &*next;
+  s.erase(target);
+  EXPECT_EQ(&*next, next_address);
+  EXPECT_EQ(*next, 32);
+  --next;
+  EXPECT_EQ(*next, 30);
+  EXPECT_TRUE(IsRedBlack(s.begin()));
+}
+
+TEST(set, MergeWithHeapAllocator) {
+  using heap_set = s21::set<int, std::less<int>, std::allocator<int>>;
+  heap_set s1;
+  heap_set s2;
+  for (int i = 0; i < 200; i += 2) s1.insert(i);
+  for (int i = 0; i < 200; ++i) s2.insert(i);
+  s1.merge(s2);
+  EXPECT_EQ(s1.size(), 200);
+  EXPECT_EQ(s2.size(), 100);
+  EXPECT_TRUE(IsRedBlack(s1.begin()));
+  EXPECT_TRUE(IsRedBlack(s2.begin()));
+}
+
+namespace {
+struct FragileKey {
+  static int copies_left;
+  int value;
+  explicit FragileKey(int v) : value(v) {}
+  FragileKey(const FragileKey &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  bool operator<(const FragileKey &other) const { return value < other.value; }
+};
+int FragileKey::copies_left = -1;
+}  // namespace
+
+TEST(set, CopyThrowsWithoutLeaking) {
+  using heap_set =
+      s21::set<FragileKey, std::less<FragileKey>, std::allocator<FragileKey>>;
+  heap_set s;
+  for (int i = 0; i < 100; ++i) s.insert(FragileKey(i));
+  FragileKey::copies_left = 50;
+  EXPECT_THROW(heap_set copy(s), std::runtime_error);
+  FragileKey::copies_left = -1;
+  EXPECT_EQ(s.size(), 100);
+}
+
+TEST(set, FromSortedIsBalanced) {
+  for (int n = 0; n <= 300; ++n) {
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; ++i) keys[i] = i;
+    auto s = s21::set<int>::from_sorted(keys.begin(), keys.end());
+    ASSERT_EQ(static_cast<int>(s.size()), n);
+    ASSERT_TRUE(IsRedBlack(s.begin())) << n;
+    int expected = 0;
+    for (auto it = s.begin(); it != s.end(); ++it) EXPECT_EQ(*it, expected++);
+  }
+}
+
+TEST(set, RangeConstructorSortsAndDropsDuplicates) {
+  std::vector<int> keys = {5, 3, 9, 3, 1, 5, 7};
+  s21::set<int> s(keys.begin(), keys.end());
+  std::set<int> expected(keys.begin(), keys.end());
+  ASSERT_EQ(s.size(), expected.size());
+  auto it = expected.begin();
+  for (auto sit = s.begin(); sit != s.end(); ++sit, ++it) EXPECT_EQ(*sit, *it);
+  EXPECT_TRUE(IsRedBlack(s.begin()));
+  s.insert(4);
+  s.erase(s.find(9));
+  EXPECT_TRUE(IsRedBlack(s.begin()));
+}
+
+TEST(set, AssignSortedReplacesContents) {
+  s21::set<std::string> s({"old"});
+  std::vector<std::string> keys = {"a", "b", "b", "c"};
+  s.assign_sorted(keys.begin(), keys.end());
+  EXPECT_EQ(s.size(), 3);
+  EXPECT_FALSE(s.contains("old"));
+  EXPECT_TRUE(s.contains("b"));
+  s21::set<std::string> copy(s.begin(), s.end());
+  EXPECT_EQ(copy.size(), 3);
+}
+
+TEST(set, MergeSplicesNodes) {
+  s21::set<int> s1({1, 3, 5});
+  s21::set<int> s2({2, 3, 4});
+  const int* two = &*s2.find(2);
+  s1.merge(s2);
+  EXPECT_EQ(s1.size(), 5);
+  EXPECT_EQ(&*s1.find(2), two);
+  ASSERT_EQ(s2.size(), 1);
+  EXPECT_EQ(*s2.begin(), 3);
+  EXPECT_TRUE(IsRedBlack(s1.begin()));
+  EXPECT_TRUE(IsRedBlack(s2.begin()));
+}
+
+TEST(set, ExtractAndInsertNode) {
+  s21::set<std::string> s1({"a", "b", "c"});
+  s21::set<std::string> s2({"c"});
+  auto handle = s1.extract("b");
+  ASSERT_FALSE(handle.empty());
+  const std::string* address = &handle.value();
+  EXPECT_EQ(s1.size(), 2);
+  auto result = s2.insert(std::move(handle));
+  EXPECT_TRUE(result.inserted);
+  EXPECT_TRUE(result.node.empty());
+  EXPECT_EQ(&*result.position, address);
+  auto duplicate = s2.insert(s1.extract("c"));
+  EXPECT_FALSE(duplicate.inserted);
+  ASSERT_FALSE(duplicate.node.empty());
+  EXPECT_EQ(duplicate.node.value(), "c");
+  EXPECT_EQ(*duplicate.position, "c");
+  EXPECT_TRUE(s1.extract("missing").empty());
+  EXPECT_EQ(s1.size(), 1);
+  EXPECT_EQ(s2.size(), 2);
+}
+
+TEST(set, MergeBetweenResources) {
+  using pmr_set =
+      s21::set<int, std::less<int>, std::pmr::polymorphic_allocator<int>>;
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  pmr_set s1(&first);
+  pmr_set s2(&second);
+  for (int i = 0; i < 10; ++i) s2.insert(i);
+  s1.insert(4);
+  s1.merge(s2);
+  EXPECT_EQ(s1.size(), 10);
+  EXPECT_EQ(s2.size(), 1);
+  EXPECT_TRUE(IsRedBlack(s1.begin()));
+}
+
+namespace {
+// Runtime sort order, the kind of comparator Compare{} could never express.
+class Direction {
+ public:
+  explicit Direction(bool descending = false) : descending_(descending) {}
+  bool operator()(int a, int b) const {
+    return descending_ ? b < a : a < b;
+  }
+
+ private:
+  bool descending_;
+};
+
+bool GreaterInt(int a, int b) { return a > b; }
+}  // namespace
+
+TEST(set, StatefulComparator) {
+  s21::set<int, Direction> down(Direction(true));
+  for (int key : {3, 1, 4, 1, 5, 9, 2, 6}) down.insert(key);
+  std::vector<int> order(down.begin(), down.end());
+  EXPECT_EQ(order, (std::vector<int>{9, 6, 5, 4, 3, 2, 1}));
+  EXPECT_TRUE(down.contains(4));
+  EXPECT_TRUE(down.key_comp()(2, 1));
+  EXPECT_TRUE(down.value_comp()(2, 1));
+
+  s21::set<int, Direction> copy(down);
+  copy.insert(7);
+  EXPECT_EQ(*copy.begin(), 9);
+  s21::set<int, Direction> up({2, 3, 1});
+  up.swap(copy);
+  EXPECT_EQ(*up.begin(), 9);
+  EXPECT_EQ(*copy.begin(), 1);
+  copy = down;
+  EXPECT_EQ(*copy.begin(), 9);
+
+  std::vector<int> keys = {5, 1, 3};
+  s21::set<int, Direction> ranged(keys.begin(), keys.end(), Direction(true));
+  EXPECT_EQ(*ranged.begin(), 5);
+}
+
+TEST(set, FunctionPointerComparator) {
+  s21::set<int, bool (*)(int, int)> set({1, 3, 2}, &GreaterInt);
+  EXPECT_EQ(*set.begin(), 3);
+  EXPECT_EQ(sizeof(set), sizeof(s21::set<int>) + sizeof(&GreaterInt));
+}
+
+TEST(set, BoundsAndCount) {
+  s21::set<int> set;
+  std::set<int> expected;
+  for (int i = 0; i < 200; i += 3) {
+    set.insert(i);
+    expected.insert(i);
+  }
+  for (int key = -2; key < 205; ++key) {
+    auto lower = set.lower_bound(key);
+    auto upper = set.upper_bound(key);
+    auto std_lower = expected.lower_bound(key);
+    auto std_upper = expected.upper_bound(key);
+    if (std_lower == expected.end())
+      EXPECT_EQ(lower, set.end());
+    else
+      EXPECT_EQ(*lower, *std_lower);
+    if (std_upper == expected.end())
+      EXPECT_EQ(upper, set.end());
+    else
+      EXPECT_EQ(*upper, *std_upper);
+    auto range = set.equal_range(key);
+    EXPECT_EQ(range.first, lower);
+    EXPECT_EQ(range.second, upper);
+    EXPECT_EQ(set.count(key), expected.count(key));
+  }
+}
+
+TEST(set, SubtreeSizesSurviveErase) {
+  s21::set<int> set;
+  for (int i = 0; i < 2000; ++i) set.insert((i * 7919) % 2000);
+  for (int i = 0; i < 2000; i += 3) set.erase(set.find((i * 31) % 2000));
+  EXPECT_TRUE(IsRedBlack(set.begin()));
+  s21::set<int> other;
+  for (int i = 2000; i < 2100; ++i) other.insert(i);
+  set.merge(other);
+  EXPECT_TRUE(IsRedBlack(set.begin()));
+  auto handle = set.extract(2050);
+  EXPECT_TRUE(IsRedBlack(set.begin()));
+  other.insert(std::move(handle));
+  EXPECT_TRUE(IsRedBlack(other.begin()));
+}
+
+TEST(set, OrderStatistics) {
+  s21::set<int> set;
+  for (int i = 0; i < 100; ++i) set.insert(i * 10);
+  EXPECT_EQ(*set.nth_element(0), 0);
+  EXPECT_EQ(*set.nth_element(42), 420);
+  EXPECT_EQ(set.nth_element(100), set.end());
+  EXPECT_EQ(set.rank(420), 42);
+  EXPECT_EQ(set.rank(425), 43);
+  EXPECT_EQ(set.rank(-1), 0);
+  EXPECT_EQ(set.count_range(100, 200), 10);
+  EXPECT_EQ(set.count_range(105, 105), 0);
+  set.erase(set.find(0));
+  EXPECT_EQ(*set.nth_element(0), 10);
+  EXPECT_EQ(set.rank(420), 41);
+}
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "test.h"
+
+template class s21::SmallVector<int, 4>;
+
+TEST(SmallVector, DefaultConstructor) {
+  s21::SmallVector<int, 8> v;
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.Size(), 0);
+  EXPECT_EQ(v.Capacity(), 8);
+  EXPECT_TRUE(v.Is_Inline());
+}
+
+TEST(SmallVector, InitializerListConstructor) {
+  s21::SmallVector<int, 4> inline_v({1, 2, 3});
+  EXPECT_TRUE(inline_v.Is_Inline());
+  EXPECT_EQ(inline_v[2], 3);
+  s21::SmallVector<int, 2> heap_v({1, 2, 3});
+  EXPECT_FALSE(heap_v.Is_Inline());
+  EXPECT_EQ(heap_v.Size(), 3);
+  EXPECT_EQ(heap_v.Back(), 3);
+}
+
+TEST(SmallVector, SizeConstructor) {
+  s21::SmallVector<int, 4> v(3);
+  EXPECT_EQ(v.Size(), 3);
+  for (size_t i = 0; i < v.Size(); ++i) EXPECT_EQ(v[i], 0);
+}
+
+TEST(SmallVector, PushBack_SpillsToHeap) {
+  s21::SmallVector<std::string, 4> v;
+  for (int i = 0; i < 4; ++i) v.Push_Back(std::to_string(i));
+  EXPECT_TRUE(v.Is_Inline());
+  v.Push_Back("4");
+  EXPECT_FALSE(v.Is_Inline());
+  EXPECT_GE(v.Capacity(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], std::to_string(i));
+}
+
+TEST(SmallVector, PushBack_OwnElement) {
+  s21::SmallVector<std::string, 2> v({"a", "b"});
+  v.Push_Back(v[0]);
+  v.Insert_Many_Back(v[1], v[2]);
+  EXPECT_EQ(v.Size(), 5);
+  EXPECT_EQ(v[2], "a");
+  EXPECT_EQ(v[3], "b");
+  EXPECT_EQ(v[4], "a");
+}
+
+TEST(SmallVector, InsertManyBack_OwnElementsWhenSpilling) {
+  s21::SmallVector<std::string, 2> v(
+      {"a string too long for the small buffer", "b"});
+  ASSERT_TRUE(v.Is_Inline());
+  v.Insert_Many_Back(v.At(0), v.At(0), v.At(1));
+  EXPECT_FALSE(v.Is_Inline());
+  ASSERT_EQ(v.Size(), 5);
+  EXPECT_EQ(v[2], v[0]);
+  EXPECT_EQ(v[3], v[0]);
+  EXPECT_EQ(v[4], "b");
+}
+
+TEST(SmallVector, InsertErase) {
+  s21::SmallVector<int, 4> v({1, 3, 4});
+  auto it = v.Insert(v.Begin() + 1, 2);
+  EXPECT_EQ(*it, 2);
+  v.Insert(v.End(), 5);
+  EXPECT_FALSE(v.Is_Inline());
+  v.Erase(v.Begin());
+  EXPECT_EQ(v.Size(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i], i + 2);
+  EXPECT_THROW(v.Erase(v.End()), std::out_of_range);
+  EXPECT_THROW(v.At(4), std::out_of_range);
+}
+
+TEST(SmallVector, InsertMany) {
+  s21::SmallVector<int, 4> v({1, 5});
+  auto it = v.Insert_Many(v.Cbegin() + 1, 2, 3, 4);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(v.Size(), 5);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(v[i], i + 1);
+}
+
+TEST(SmallVector, Insert_OwnElementWhenSpilling) {
+  s21::SmallVector<std::string, 2> v(
+      {"a string too long for the small buffer", "b"});
+  v.Insert(v.Begin() + 1, v[0]);
+  EXPECT_FALSE(v.Is_Inline());
+  ASSERT_EQ(v.Size(), 3);
+  EXPECT_EQ(v[1], v[0]);
+  EXPECT_EQ(v[2], "b");
+  const std::string* data = v.Data();
+  v.Emplace(v.Cbegin(), v[2]);
+  EXPECT_EQ(v.Data(), data);
+  EXPECT_EQ(v[0], "b");
+  EXPECT_EQ(v[3], "b");
+}
+
+TEST(SmallVector, InsertMany_ShiftsTailOnce) {
+  s21::SmallVector<std::string, 8> v({"a", "f", "g"});
+  auto it = v.Insert_Many(v.Cbegin() + 1, "b", std::string("c"), "d", "e");
+  EXPECT_TRUE(v.Is_Inline());
+  EXPECT_EQ(*it, "f");
+  v.Insert_Many(v.Cend(), "h", "i");
+  EXPECT_FALSE(v.Is_Inline());
+  v.Insert_Many(v.Cbegin(), v[8], v[7]);
+  std::string joined;
+  for (size_t i = 0; i < v.Size(); ++i) joined += v[i];
+  EXPECT_EQ(joined, "ihabcdefghi");
+}
+
+TEST(SmallVector, ReserveAndShrink) {
+  s21::SmallVector<int, 4> v({1, 2});
+  v.Reserve(3);
+  EXPECT_TRUE(v.Is_Inline());
+  v.Reserve(32);
+  EXPECT_FALSE(v.Is_Inline());
+  EXPECT_EQ(v.Capacity(), 32);
+  v.Shrink_To_Fit();
+  EXPECT_TRUE(v.Is_Inline());
+  EXPECT_EQ(v.Capacity(), 4);
+  EXPECT_EQ(v[1], 2);
+}
+
+TEST(SmallVector, CopyAndMove) {
+  s21::SmallVector<std::string, 2> small({"x"});
+  s21::SmallVector<std::string, 2> big({"a", "b", "c"});
+  s21::SmallVector<std::string, 2> small_copy(small);
+  s21::SmallVector<std::string, 2> big_copy(big);
+  EXPECT_EQ(small_copy[0], "x");
+  EXPECT_EQ(big_copy[2], "c");
+  s21::SmallVector<std::string, 2> moved_small(std::move(small));
+  s21::SmallVector<std::string, 2> moved_big(std::move(big));
+  EXPECT_TRUE(small.empty());
+  EXPECT_TRUE(big.empty());
+  EXPECT_TRUE(big.Is_Inline());
+  EXPECT_EQ(moved_small[0], "x");
+  EXPECT_EQ(moved_big[1], "b");
+  moved_small = moved_big;
+  EXPECT_EQ(moved_small.Size(), 3);
+  moved_big = std::move(small_copy);
+  EXPECT_EQ(moved_big.Size(), 1);
+  EXPECT_TRUE(moved_big.Is_Inline());
+}
+
+TEST(SmallVector, Swap) {
+  s21::SmallVector<int, 2> a({1});
+  s21::SmallVector<int, 2> b({2, 3, 4});
+  a.Swap(b);
+  EXPECT_EQ(a.Size(), 3);
+  EXPECT_EQ(b.Size(), 1);
+  EXPECT_EQ(a[2], 4);
+  EXPECT_EQ(b[0], 1);
+}
+
+TEST(SmallVector, PopBackClear) {
+  s21::SmallVector<int, 2> v({1, 2, 3});
+  v.Pop_Back();
+  EXPECT_EQ(v.Back(), 2);
+  v.Clear();
+  EXPECT_TRUE(v.empty());
+  EXPECT_THROW(v.Front(), std::out_of_range);
+  v.Pop_Back();
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(SmallVector, MoveOnlyElements) {
+  s21::SmallVector<std::unique_ptr<int>, 2> v;
+  for (int i = 0; i < 5; ++i) v.Emplace_Back(std::make_unique<int>(i));
+  v.Emplace(v.Cbegin(), std::make_unique<int>(-1));
+  v.Erase(v.Begin() + 1);
+  s21::SmallVector<std::unique_ptr<int>, 2> other(std::move(v));
+  EXPECT_EQ(other.Size(), 5);
+  EXPECT_EQ(*other[0], -1);
+  EXPECT_EQ(*other[4], 4);
+}
+
+TEST(SmallVector, Iterators) {
+  s21::SmallVector<int, 4> v({3, 1, 2});
+  std::sort(v.Begin(), v.End());
+  int expected = 1;
+  for (auto it = v.Cbegin(); it != v.Cend(); ++it) EXPECT_EQ(*it, expected++);
+}
@@ -0,0 +1,137 @@
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test.h"
+
+template class s21::spsc_queue<int>;
+
+namespace {
+// Counts live instances, to check that leftovers are destroyed.
+struct Counted {
+  static inline int live = 0;
+  explicit Counted(int v) : value(v) { ++live; }
+  Counted(const Counted &other) : value(other.value) { ++live; }
+  ~Counted() { --live; }
+  int value;
+};
+}  // namespace
+
+TEST(SpscQueue, PushPopFrontInOrder) {
+  s21::spsc_queue<int> queue(4);
+  EXPECT_EQ(queue.capacity(), 4);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_THROW(queue.front(), std::out_of_range);
+  EXPECT_THROW(queue.pop(), std::out_of_range);
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 3; ++i) queue.push(round * 10 + i);
+    EXPECT_EQ(queue.size(), 3);
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_EQ(queue.front(), round * 10 + i);
+      queue.pop();
+    }
+  }
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueue, CapacityRoundsUpAndBoundsPushes) {
+  s21::spsc_queue<int> queue(5);
+  EXPECT_EQ(queue.capacity(), 8);
+  for (int i = 0; i < 8; ++i) EXPECT_TRUE(queue.try_push(i));
+  EXPECT_FALSE(queue.try_push(8));
+  EXPECT_EQ(queue.size(), 8);
+  int out = -1;
+  EXPECT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out, 0);
+  EXPECT_TRUE(queue.try_push(8));
+  EXPECT_THROW(s21::spsc_queue<int>(0), std::length_error);
+}
+
+TEST(SpscQueue, BatchPushAndPopAcrossTheWrap) {
+  s21::spsc_queue<int> queue(8);
+  std::vector<int> values = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(queue.try_push_n(values.begin(), 5), 5);
+  std::vector<int> out(11, -1);
+  EXPECT_EQ(queue.try_pop_n(out.begin(), 3), 3);
+  EXPECT_EQ(queue.try_push_n(values.begin() + 5, 5), 5);
+  EXPECT_EQ(queue.try_push_n(values.begin(), 3), 1);
+  EXPECT_EQ(queue.try_pop_n(out.begin() + 3, 10), 8);
+  EXPECT_EQ(out, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0}));
+  EXPECT_EQ(queue.try_pop_n(out.begin(), 10), 0);
+}
+
+TEST(SpscQueue, MoveOnlyValuesAndLeftoversAreDestroyed) {
+  {
+    s21::spsc_queue<std::unique_ptr<int>> queue(4);
+    queue.push(std::make_unique<int>(1));
+    queue.emplace(new int(2));
+    std::unique_ptr<int> out;
+    EXPECT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(*out, 1);
+    EXPECT_EQ(*queue.front(), 2);
+  }
+  {
+    s21::spsc_queue<Counted> queue(4);
+    queue.emplace(1);
+    queue.emplace(2);
+    queue.pop();
+    EXPECT_EQ(Counted::live, 1);
+  }
+  EXPECT_EQ(Counted::live, 0);
+}
+
+TEST(SpscQueue, TwoThreadsTransferEveryValueInOrder) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<int> queue(64);
+  std::thread producer([&queue] {
+    for (int i = 0; i < kCount; ++i) queue.push(i);
+  });
+  int expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    int value = 0;
+    if (queue.try_pop(value)) ordered &= value == expected++;
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(SpscQueue, TwoThreadsTransferInBatches) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<std::string> queue(128);
+  std::thread producer([&queue] {
+    std::vector<std::string> batch;
+    for (int i = 0; i < kCount;) {
+      batch.clear();
+      for (int j = 0; j < 32 && i + j < kCount; ++j)
+        batch.push_back(std::to_string(i + j));
+      for (std::size_t pushed = 0; pushed < batch.size();)
+        pushed += queue.try_push_n(batch.begin() + pushed,
+                                   batch.size() - pushed);
+      i += static_cast<int>(batch.size());
+    }
+  });
+  std::vector<std::string> out(50);
+  int expected = 0;
+  bool ordered = true;
+  while (expected < kCount) {
+    const auto popped = queue.try_pop_n(out.begin(), out.size());
+    for (std::size_t i = 0; i < popped; ++i)
+      ordered &= out[i] == std::to_string(expected++);
+  }
+  producer.join();
+  EXPECT_TRUE(ordered);
+}
+
+TEST(SpscQueue, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  s21::spsc_queue<std::pmr::string,
+                  std::pmr::polymorphic_allocator<std::pmr::string>>
+      queue(4, &resource);
+  queue.push(std::pmr::string("a string well beyond the small buffer"));
+  EXPECT_EQ(queue.front().get_allocator().resource(), &resource);
+}
@@ -1,3 +1,4 @@
+#include <memory_resource>
 #include <stack>
 
 #include "test.h"
@@ -182,3 +183,29 @@ TEST(Stack, SwapThrow) {
   s21::queue<int> q({3, 2, 1});
   EXPECT_THROW(s.swap(q), std::invalid_argument);
 }
+
+TEST(Stack, Emplace) {
+  s21::stack<std::pair<std::string, int>> s;
+  s.emplace("first", 1);
+  s.push(std::make_pair(std::string("second"), 2));
+  EXPECT_EQ(s.size(), 2);
+  EXPECT_EQ(s.top().first, "second");
+  s.pop();
+  EXPECT_EQ(s.top().second, 1);
+}
+
+TEST(Stack, Allocator_NodesComeFromResource) {
+  alignas(std::max_align_t) unsigned char buf[2048];
+  std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf),
+                                            std::pmr::null_memory_resource());
+  s21::stack<int, std::pmr::polymorphic_allocator<int>> s(&arena);
+  for (int i = 0; i < 16; ++i) s.push(i);
+  const auto* top = reinterpret_cast<const unsigned char*>(&s.top());
+  EXPECT_TRUE(top >= buf && top < buf + sizeof(buf));
+  s21::stack<int, std::pmr::polymorphic_allocator<int>> other(
+      std::pmr::new_delete_resource());
+  other = std::move(s);
+  EXPECT_EQ(other.get_allocator().resource(), std::pmr::new_delete_resource());
+  EXPECT_EQ(other.size(), 16);
+  EXPECT_EQ(other.top(), 15);
+}
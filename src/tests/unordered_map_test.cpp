@@ -0,0 +1,180 @@
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "test.h"
+
+template class s21::unordered_map<int, int>;
+
+namespace {
+// Counts its copies and throws from them once armed. Moves never throw,
+// so a container that only moves keys around keeps working.
+struct FragileKey {
+  static inline int copies = 0;
+  static inline bool armed = false;
+  explicit FragileKey(int v) noexcept : value(v) {}
+  FragileKey(const FragileKey &other) : value(other.value) {
+    ++copies;
+    if (armed) throw std::runtime_error("key copied");
+  }
+  FragileKey(FragileKey &&other) noexcept : value(other.value) {}
+  FragileKey &operator=(const FragileKey &) = default;
+  bool operator<(const FragileKey &other) const noexcept {
+    return value < other.value;
+  }
+  bool operator==(const FragileKey &other) const noexcept {
+    return value == other.value;
+  }
+  int value;
+};
+
+struct FragileKeyHash {
+  size_t operator()(const FragileKey &key) const noexcept {
+    return std::hash<int>()(key.value);
+  }
+};
+
+template <typename Map>
+std::vector<std::pair<int, int>> Sorted(const Map &map) {
+  std::vector<std::pair<int, int>> entries;
+  for (const auto &entry : map) entries.emplace_back(entry.first, entry.second);
+  std::sort(entries.begin(), entries.end());
+  return entries;
+}
+}  // namespace
+
+TEST(unordered_map, InsertLookupAndAssign) {
+  s21::unordered_map<int, int> map;
+  EXPECT_TRUE(map.insert(1, 10).second);
+  EXPECT_FALSE(map.insert(1, 11).second);
+  EXPECT_TRUE(map.insert({2, 20}).second);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_THROW(map.at(3), std::out_of_range);
+  EXPECT_EQ(map[3], 0);
+  map[3] = 30;
+  EXPECT_EQ(map.at(3), 30);
+  auto result = map.insert_or_assign(1, 15);
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(result.first->second, 15);
+  EXPECT_TRUE(map.insert_or_assign(4, 40).second);
+  EXPECT_EQ(map.size(), 4);
+  EXPECT_EQ(map.find(2)->second, 20);
+  EXPECT_EQ(map.find(5), map.end());
+  EXPECT_TRUE(map.contains(4));
+  EXPECT_EQ(map.count(5), 0);
+  const auto &view = map;
+  EXPECT_EQ(view.at(4), 40);
+  EXPECT_EQ(view.find(3)->second, 30);
+  EXPECT_EQ(Sorted(map), (std::vector<std::pair<int, int>>{
+                             {1, 15}, {2, 20}, {3, 30}, {4, 40}}));
+}
+
+TEST(unordered_map, RandomOperationsMatchStdUnorderedMap) {
+  s21::unordered_map<int, int> map;
+  std::unordered_map<int, int> expected;
+  unsigned state = 3U;
+  for (int round = 0; round < 50000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 4000U);
+    switch ((state >> 8) % 4U) {
+      case 0:
+        EXPECT_EQ(map.erase(key), expected.erase(key));
+        break;
+      case 1:
+        map[key] += round;
+        expected[key] += round;
+        break;
+      default:
+        EXPECT_EQ(map.insert(key, round).second,
+                  expected.insert({key, round}).second);
+    }
+    ASSERT_EQ(map.size(), expected.size());
+  }
+  std::vector<std::pair<int, int>> wanted(expected.begin(), expected.end());
+  std::sort(wanted.begin(), wanted.end());
+  EXPECT_EQ(Sorted(map), wanted);
+}
+
+TEST(unordered_map, MoveOnlyValuesAndGrowth) {
+  s21::unordered_map<int, std::unique_ptr<int>> map;
+  for (int i = 0; i < 2000; ++i)
+    map.insert({i, std::make_unique<int>(i * 2)});
+  EXPECT_EQ(map.size(), 2000);
+  for (int i = 0; i < 2000; ++i) EXPECT_EQ(*map.at(i), i * 2);
+  s21::unordered_map<int, std::unique_ptr<int>> moved(std::move(map));
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(*moved.at(1999), 3998);
+  EXPECT_EQ(moved[5000], nullptr);
+}
+
+TEST(unordered_map, CopyMoveSwapAndMerge) {
+  s21::unordered_map<int, int> original({{1, 1}, {2, 2}});
+  s21::unordered_map<int, int> copy(original);
+  copy[1] = 10;
+  EXPECT_EQ(original.at(1), 1);
+  s21::unordered_map<int, int> target;
+  target = copy;
+  EXPECT_EQ(target.at(1), 10);
+  target = std::move(original);
+  EXPECT_EQ(target.at(1), 1);
+  s21::unordered_map<int, int> source({{2, 20}, {3, 30}});
+  target.merge(source);
+  EXPECT_EQ(Sorted(target),
+            (std::vector<std::pair<int, int>>{{1, 1}, {2, 2}, {3, 30}}));
+  EXPECT_EQ(Sorted(source), (std::vector<std::pair<int, int>>{{2, 20}}));
+  target.swap(source);
+  EXPECT_EQ(target.size(), 1);
+  EXPECT_EQ(source.size(), 3);
+  source.insert_many(std::make_pair(4, 40), std::make_pair(1, 99));
+  EXPECT_EQ(source.at(4), 40);
+  EXPECT_EQ(source.at(1), 1);
+}
+
+TEST(unordered_map, EraseWhileIteratingVisitsEveryEntry) {
+  s21::unordered_map<int, int> map;
+  for (int i = 0; i < 5000; ++i) map[i] = i;
+  int visited = 0;
+  for (auto it = map.begin(); it != map.end();) {
+    ++visited;
+    if (it->first % 3 == 0)
+      it = map.erase(it);
+    else
+      ++it;
+  }
+  EXPECT_EQ(visited, 5000);
+  EXPECT_EQ(map.size(), 3333);
+  for (int i = 0; i < 5000; ++i) EXPECT_EQ(map.contains(i), i % 3 != 0);
+}
+
+TEST(unordered_map, Allocator_PropagatesToKeysAndValues) {
+  using entry = std::pair<const std::pmr::string, std::pmr::string>;
+  std::pmr::monotonic_buffer_resource resource;
+  s21::unordered_map<std::pmr::string, std::pmr::string,
+                     std::hash<std::pmr::string>,
+                     std::equal_to<std::pmr::string>,
+                     std::pmr::polymorphic_allocator<entry>>
+      map(&resource);
+  const std::pmr::string key("a key well beyond the small string buffer");
+  map[key] = "a value well beyond the small string buffer";
+  EXPECT_EQ(map.begin()->first.get_allocator().resource(), &resource);
+  EXPECT_EQ(map.begin()->second.get_allocator().resource(), &resource);
+}
+
+TEST(unordered_map, ShiftsMoveKeysInsteadOfCopying) {
+  s21::unordered_map<FragileKey, int, FragileKeyHash> m;
+  FragileKey::copies = 0;
+  for (int i = 0; i < 1000; ++i) m.insert(FragileKey(i), i);
+  EXPECT_EQ(FragileKey::copies, 1000);  // only when each value is built
+  FragileKey::copies = 0;
+  FragileKey::armed = true;
+  for (int i = 0; i < 1000; i += 2) EXPECT_EQ(m.erase(FragileKey(i)), 1U);
+  FragileKey::armed = false;
+  EXPECT_EQ(FragileKey::copies, 0);
+  EXPECT_EQ(m.size(), 500);
+  for (int i = 1; i < 1000; i += 2) EXPECT_EQ(m.at(FragileKey(i)), i);
+}
@@ -0,0 +1,183 @@
+#include <algorithm>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "test.h"
+
+template class s21::unordered_set<int>;
+
+namespace {
+template <typename Set>
+std::vector<int> Sorted(const Set &set) {
+  std::vector<int> items(set.begin(), set.end());
+  std::sort(items.begin(), items.end());
+  return items;
+}
+
+// Sends every key to a handful of hash values, to force long runs.
+struct PoorHash {
+  std::size_t operator()(int key) const noexcept {
+    return static_cast<std::size_t>(key % 3);
+  }
+};
+
+struct StringHash {
+  using is_transparent = void;
+  std::size_t operator()(std::string_view key) const noexcept {
+    return std::hash<std::string_view>()(key);
+  }
+};
+}  // namespace
+
+TEST(unordered_set, InsertFindAndErase) {
+  s21::unordered_set<int> set;
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.find(1), set.end());
+  EXPECT_EQ(set.begin(), set.end());
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(set.insert(i * 7).second);
+  EXPECT_FALSE(set.insert(70).second);
+  EXPECT_EQ(*set.insert(70).first, 70);
+  EXPECT_EQ(set.size(), 1000);
+  EXPECT_TRUE(set.contains(6993));
+  EXPECT_FALSE(set.contains(6994));
+  EXPECT_EQ(set.count(14), 1);
+  EXPECT_EQ(set.count(15), 0);
+  EXPECT_EQ(*set.find(21), 21);
+  EXPECT_EQ(set.erase(21), 1);
+  EXPECT_EQ(set.erase(21), 0);
+  EXPECT_EQ(set.find(21), set.end());
+  EXPECT_EQ(set.size(), 999);
+}
+
+TEST(unordered_set, RandomInsertEraseMatchesStdUnorderedSet) {
+  s21::unordered_set<int> set;
+  std::unordered_set<int> expected;
+  unsigned state = 11U;
+  for (int round = 0; round < 50000; ++round) {
+    state = state * 1103515245U + 12345U;
+    const int key = static_cast<int>((state >> 16) % 5000U);
+    if ((state >> 8) % 3U == 0U) {
+      EXPECT_EQ(set.erase(key), expected.erase(key));
+    } else {
+      EXPECT_EQ(set.insert(key).second, expected.insert(key).second);
+    }
+    ASSERT_EQ(set.size(), expected.size());
+  }
+  EXPECT_EQ(Sorted(set),
+            Sorted(std::vector<int>(expected.begin(), expected.end())));
+  EXPECT_LE(set.load_factor(), set.max_load_factor());
+}
+
+TEST(unordered_set, EraseWhileIterating) {
+  s21::unordered_set<int> set;
+  for (int i = 0; i < 3000; ++i) set.insert(i);
+  for (auto it = set.begin(); it != set.end();) {
+    if (*it % 2 == 0)
+      it = set.erase(it);
+    else
+      ++it;
+  }
+  EXPECT_EQ(set.size(), 1500);
+  for (int i = 0; i < 3000; ++i) EXPECT_EQ(set.contains(i), i % 2 == 1);
+  for (auto it = set.begin(); it != set.end();) it = set.erase(it);
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+}
+
+TEST(unordered_set, CollidingHashesStayCorrect) {
+  s21::unordered_set<int, PoorHash> set;
+  for (int i = 0; i < 300; ++i) EXPECT_TRUE(set.insert(i).second);
+  for (int i = 0; i < 300; ++i) EXPECT_FALSE(set.insert(i).second);
+  EXPECT_EQ(set.size(), 300);
+  for (int i = 0; i < 300; i += 2) EXPECT_EQ(set.erase(i), 1);
+  for (int i = 0; i < 300; ++i) EXPECT_EQ(set.contains(i), i % 2 == 1);
+  EXPECT_EQ(Sorted(set).size(), 150);
+}
+
+TEST(unordered_set, OverflowingRunThrowsAndKeepsValues) {
+  s21::unordered_set<int, PoorHash> set;
+  int inserted = 0;
+  EXPECT_THROW(
+      for (; inserted < 1000; ++inserted) set.insert(inserted),
+      std::overflow_error);
+  EXPECT_EQ(set.size(), static_cast<std::size_t>(inserted));
+  for (int i = 0; i < inserted; ++i) EXPECT_TRUE(set.contains(i));
+  EXPECT_FALSE(set.contains(inserted));
+}
+
+TEST(unordered_set, LoadFactorReserveAndRehash) {
+  s21::unordered_set<int> set;
+  EXPECT_EQ(set.bucket_count(), 0);
+  EXPECT_FLOAT_EQ(set.load_factor(), 0.0f);
+  EXPECT_THROW(set.max_load_factor(0.0f), std::invalid_argument);
+  EXPECT_THROW(set.max_load_factor(1.5f), std::invalid_argument);
+  set.max_load_factor(0.5f);
+  set.reserve(1000);
+  const auto buckets = set.bucket_count();
+  EXPECT_GE(buckets, 2000);
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  EXPECT_EQ(set.bucket_count(), buckets);
+  set.max_load_factor(0.25f);
+  EXPECT_GE(set.bucket_count(), 4000);
+  EXPECT_LE(set.load_factor(), 0.25f);
+  set.max_load_factor(1.0f);
+  set.rehash(0);
+  EXPECT_EQ(set.bucket_count(), 1024);
+  for (int i = 0; i < 1000; ++i) EXPECT_TRUE(set.contains(i));
+  set.clear();
+  EXPECT_EQ(set.bucket_count(), 1024);
+  EXPECT_TRUE(set.empty());
+}
+
+TEST(unordered_set, CopyMoveSwapAndMerge) {
+  s21::unordered_set<int> original({5, 1, 3});
+  s21::unordered_set<int> copy(original);
+  copy.erase(1);
+  EXPECT_TRUE(original.contains(1));
+  s21::unordered_set<int> moved(std::move(copy));
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{3, 5}));
+  moved = original;
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{1, 3, 5}));
+  s21::unordered_set<int> source({2, 3, 4, 5, 6});
+  moved.merge(source);
+  EXPECT_EQ(Sorted(moved), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+  EXPECT_EQ(Sorted(source), (std::vector<int>{3, 5}));
+  moved.swap(source);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(source.size(), 6);
+  source = std::move(moved);
+  EXPECT_EQ(Sorted(source), (std::vector<int>{3, 5}));
+  source.insert_many(7, 8, 3);
+  EXPECT_EQ(Sorted(source), (std::vector<int>{3, 5, 7, 8}));
+}
+
+TEST(unordered_set, TransparentLookupAndStrings) {
+  s21::unordered_set<std::string, StringHash, std::equal_to<>> names;
+  for (int i = 0; i < 500; ++i) names.emplace("name-" + std::to_string(i));
+  EXPECT_TRUE(names.contains(std::string_view("name-42")));
+  EXPECT_EQ(names.find(std::string_view("name-499"))->back(), '9');
+  EXPECT_FALSE(names.contains(std::string_view("name-500")));
+  EXPECT_EQ(names.erase("name-7"), 1);
+  EXPECT_EQ(names.size(), 499);
+}
+
+TEST(unordered_set, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource resource;
+  using Alloc = std::pmr::polymorphic_allocator<std::pmr::string>;
+  using Set = s21::unordered_set<std::pmr::string, std::hash<std::pmr::string>,
+                                 std::equal_to<std::pmr::string>, Alloc>;
+  Set set(&resource);
+  for (int i = 0; i < 100; ++i)
+    set.insert(std::pmr::string("a string well beyond the small buffer " +
+                                std::to_string(i)));
+  EXPECT_EQ(set.begin()->get_allocator().resource(), &resource);
+  std::pmr::monotonic_buffer_resource other_resource;
+  Set other(&other_resource);
+  other = std::move(set);
+  EXPECT_EQ(other.size(), 100);
+  EXPECT_EQ(other.begin()->get_allocator().resource(), &other_resource);
+}
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <memory>
+#include <memory_resource>
+#include <string>
 #include <vector>
 
 #include "test.h"
@@ -135,11 +139,13 @@ TEST(VectorTest, IndexOperator_ValidIndex) {
   EXPECT_EQ(v[4], 5);
 }
 
-TEST(VectorTest, IndexOperator_InvalidIndex) {
+#ifdef S21_CHECKED_ACCESS
+TEST(VectorDeathTest, IndexOperator_InvalidIndex) {
   s21::Vector<int> v({1, 2, 3, 4, 5});
-  EXPECT_ANY_THROW(v[5]);
-  EXPECT_ANY_THROW(v[10]);
+  EXPECT_DEATH(v[5], "index out of range");
+  EXPECT_DEATH(v[10], "index out of range");
 }
+#endif
 
 TEST(VectorTest, ConstIndexOperator_ValidIndex) {
   const s21::Vector<int> v({1, 2, 3, 4, 5});
@@ -148,12 +154,21 @@ TEST(VectorTest, ConstIndexOperator_ValidIndex) {
   EXPECT_EQ(v[4], 5);
 }
 
-TEST(VectorTest, ConstIndexOperator_InvalidIndex) {
+TEST(VectorTest, ConstAt_InvalidIndex) {
   const s21::Vector<int> v({1, 2, 3, 4, 5});
-  EXPECT_ANY_THROW(v[5]);
-  EXPECT_ANY_THROW(v[10]);
+  EXPECT_EQ(v.At(4), 5);
+  EXPECT_THROW(v.At(5), std::out_of_range);
+  EXPECT_THROW(v.At(10), std::out_of_range);
 }
 
+#ifdef S21_CHECKED_ACCESS
+TEST(VectorDeathTest, ConstIndexOperator_InvalidIndex) {
+  const s21::Vector<int> v({1, 2, 3, 4, 5});
+  EXPECT_DEATH(v[5], "index out of range");
+  EXPECT_DEATH(v[10], "index out of range");
+}
+#endif
+
 TEST(VectorTest, FrontConst_ValidVector) {
   const s21::Vector<int> v({1, 2, 3, 4, 5});
   EXPECT_EQ(v.Front(), 1);
@@ -421,6 +436,31 @@ TEST(VectorTest, PushBack_NonEmptyVector) {
   EXPECT_EQ(v[3], 4);
 }
 
+TEST(VectorTest, PushBack_GeometricGrowth) {
+  s21::Vector<int> v;
+  size_t reallocations = 0;
+  const int* data = v.Data();
+  for (int i = 0; i < 1000; ++i) {
+    v.Push_Back(i);
+    if (v.Data() != data) {
+      ++reallocations;
+      data = v.Data();
+    }
+  }
+  EXPECT_EQ(v.Size(), 1000);
+  EXPECT_GE(v.Capacity(), v.Size());
+  EXPECT_LE(reallocations, 11);
+  for (int i = 0; i < 1000; ++i) EXPECT_EQ(v[i], i);
+}
+
+TEST(VectorTest, PushBack_OwnElement) {
+  s21::Vector<int> v({1, 2, 3});
+  v.Shrink_To_Fit();
+  v.Push_Back(v[0]);
+  EXPECT_EQ(v.Size(), 4);
+  EXPECT_EQ(v[3], 1);
+}
+
 TEST(VectorTest, PopBack_NonEmptyVector) {
   s21::Vector<int> v({1, 2, 3});
   v.Pop_Back();
@@ -434,6 +474,27 @@ TEST(VectorTest, PopBack_EmptyVector) {
   EXPECT_TRUE(v.empty());
 }
 
+TEST(VectorTest, PopBack_KeepsCapacity) {
+  s21::Vector<int> v({1, 2, 3});
+  const size_t capacity = v.Capacity();
+  const int* data = v.Data();
+  v.Pop_Back();
+  v.Pop_Back();
+  EXPECT_EQ(v.Size(), 1);
+  EXPECT_EQ(v.Capacity(), capacity);
+  EXPECT_EQ(v.Data(), data);
+  v.Push_Back(5);
+  EXPECT_EQ(v.Data(), data);
+  EXPECT_EQ(v.Back(), 5);
+}
+
+TEST(VectorTest, Insert_EmptyVector) {
+  s21::Vector<int> v;
+  auto it = v.Insert(v.Begin(), 7);
+  EXPECT_EQ(v.Size(), 1);
+  EXPECT_EQ(*it, 7);
+}
+
 TEST(VectorTest, Swap_NonEmptyVectors) {
   s21::Vector<int> v1({1, 2, 3});
   s21::Vector<int> v2({4, 5, 6});
@@ -529,3 +590,295 @@ TEST(VectorTest, VectorIteratorConst) {
   --it;
   EXPECT_EQ(*it, 1);
 }
+
+namespace {
+struct Counted {
+  static int constructed;
+  static int destroyed;
+  int value;
+  explicit Counted(int v) : value(v) { ++constructed; }
+  Counted(const Counted& other) : value(other.value) { ++constructed; }
+  Counted(Counted&& other) noexcept : value(other.value) { ++constructed; }
+  Counted& operator=(const Counted&) = default;
+  Counted& operator=(Counted&&) = default;
+  ~Counted() { ++destroyed; }
+};
+int Counted::constructed = 0;
+int Counted::destroyed = 0;
+}  // namespace
+
+TEST(VectorTest, Reserve_NoElementConstruction) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+  {
+    s21::Vector<Counted> v;
+    v.Reserve(1000);
+    EXPECT_EQ(v.Capacity(), 1000);
+    EXPECT_EQ(Counted::constructed, 0);
+    v.Push_Back(Counted(1));
+    v.Push_Back(Counted(2));
+    EXPECT_EQ(v.Size(), 2);
+    EXPECT_EQ(v[1].value, 2);
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+TEST(VectorTest, NonDefaultConstructible_Operations) {
+  Counted::constructed = 0;
+  Counted::destroyed = 0;
+  {
+    s21::Vector<Counted> v;
+    for (int i = 0; i < 10; ++i) v.Push_Back(Counted(i));
+    v.Insert(v.Begin(), Counted(-1));
+    v.Erase(v.Begin() + 5);
+    v.Pop_Back();
+    s21::Vector<Counted> copy(v);
+    copy.Shrink_To_Fit();
+    EXPECT_EQ(copy.Size(), 9);
+    EXPECT_EQ(copy.Capacity(), 9);
+    EXPECT_EQ(copy[0].value, -1);
+    EXPECT_EQ(copy[5].value, 5);
+    EXPECT_EQ(copy.Back().value, 8);
+    v.Clear();
+    EXPECT_TRUE(v.empty());
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+namespace {
+struct ThrowingCopy {
+  static int copies_left;
+  int value;
+  explicit ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy& other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+  }
+  ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+int ThrowingCopy::copies_left = 0;
+}  // namespace
+
+TEST(VectorTest, Reserve_StrongGuarantee) {
+  s21::Vector<ThrowingCopy> v;
+  ThrowingCopy::copies_left = 100;
+  for (int i = 0; i < 4; ++i) v.Push_Back(ThrowingCopy(i));
+  v.Shrink_To_Fit();
+  ThrowingCopy::copies_left = 2;
+  EXPECT_THROW(v.Reserve(16), std::runtime_error);
+  EXPECT_EQ(v.Size(), 4);
+  EXPECT_EQ(v.Capacity(), 4);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i].value, i);
+}
+
+namespace {
+struct CopyCounter {
+  static int copies;
+  std::string name;
+  int id;
+  CopyCounter(std::string n, int i) : name(std::move(n)), id(i) {}
+  CopyCounter(const CopyCounter& other) : name(other.name), id(other.id) {
+    ++copies;
+  }
+  CopyCounter(CopyCounter&&) noexcept = default;
+  CopyCounter& operator=(const CopyCounter& other) {
+    name = other.name;
+    id = other.id;
+    ++copies;
+    return *this;
+  }
+  CopyCounter& operator=(CopyCounter&&) noexcept = default;
+};
+int CopyCounter::copies = 0;
+}  // namespace
+
+TEST(VectorTest, EmplaceBack_NoCopies) {
+  CopyCounter::copies = 0;
+  s21::Vector<CopyCounter> v;
+  for (int i = 0; i < 100; ++i) {
+    CopyCounter& ref = v.Emplace_Back("item", i);
+    EXPECT_EQ(ref.id, i);
+  }
+  v.Push_Back(CopyCounter("moved", 100));
+  v.Insert_Many_Back(CopyCounter("a", 101), CopyCounter("b", 102));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(v.Size(), 103);
+  EXPECT_EQ(v[100].name, "moved");
+  EXPECT_EQ(v.Back().id, 102);
+}
+
+TEST(VectorTest, Emplace_Positions) {
+  CopyCounter::copies = 0;
+  s21::Vector<CopyCounter> v;
+  v.Emplace(v.Cbegin(), "b", 2);
+  v.Emplace(v.Cbegin(), "a", 1);
+  auto it = v.Emplace(v.Cend(), "d", 4);
+  EXPECT_EQ((*it).id, 4);
+  auto pos = v.Cbegin();
+  ++pos;
+  ++pos;
+  it = v.Emplace(pos, "c", 3);
+  EXPECT_EQ((*it).name, "c");
+  EXPECT_EQ(CopyCounter::copies, 0);
+  for (int i = 0; i < 4; ++i) EXPECT_EQ(v[i].id, i + 1);
+}
+
+TEST(VectorTest, EmplaceBack_OwnElement) {
+  s21::Vector<std::string> v({"first", "second"});
+  v.Shrink_To_Fit();
+  v.Emplace_Back(v[0]);
+  v.Insert(v.Begin(), v[1]);
+  EXPECT_EQ(v.Size(), 4);
+  EXPECT_EQ(v[0], "second");
+  EXPECT_EQ(v[3], "first");
+}
+
+namespace {
+struct Pod {
+  int key;
+  double weight;
+  char tag[8];
+};
+
+struct OwningHandle {
+  std::unique_ptr<int> value;
+  explicit OwningHandle(int v) : value(std::make_unique<int>(v)) {}
+};
+}  // namespace
+
+template <>
+struct s21::is_trivially_relocatable<OwningHandle> : std::true_type {};
+
+TEST(VectorTest, TriviallyCopyable_Relocation) {
+  s21::Vector<Pod> v;
+  for (int i = 0; i < 50; ++i) v.Push_Back(Pod{i, i * 0.5, "pod"});
+  v.Insert(v.Begin(), Pod{-1, 0.0, "front"});
+  v.Erase(v.Begin() + 10);
+  s21::Vector<Pod> copy(v);
+  EXPECT_EQ(copy.Size(), 50);
+  EXPECT_EQ(copy[0].key, -1);
+  EXPECT_EQ(copy[9].key, 8);
+  EXPECT_EQ(copy[10].key, 10);
+  EXPECT_EQ(copy.Back().key, 49);
+  EXPECT_STREQ(copy[0].tag, "front");
+}
+
+TEST(VectorTest, TriviallyRelocatable_Relocation) {
+  s21::Vector<OwningHandle> v;
+  for (int i = 0; i < 40; ++i) v.Emplace_Back(i);
+  v.Emplace(v.Cbegin(), -1);
+  v.Erase(v.Begin() + 1);
+  v.Shrink_To_Fit();
+  EXPECT_EQ(v.Size(), 40);
+  EXPECT_EQ(*v[0].value, -1);
+  EXPECT_EQ(*v[1].value, 1);
+  EXPECT_EQ(*v[39].value, 39);
+}
+
+TEST(VectorTest, RandomAccessIterator) {
+  s21::Vector<int> v({5, 3, 9, 1, 7});
+  std::sort(v.Begin(), v.End());
+  for (size_t i = 1; i < v.Size(); ++i) EXPECT_LT(v[i - 1], v[i]);
+  auto it = v.Begin();
+  EXPECT_EQ(v.End() - it, 5);
+  EXPECT_EQ(it[2], 5);
+  EXPECT_EQ(*(2 + it), 5);
+  it += 4;
+  EXPECT_EQ(*it, 9);
+  it -= 1;
+  EXPECT_EQ(*it, 7);
+  EXPECT_TRUE(v.Begin() < it);
+  EXPECT_TRUE(it <= v.End() - 2);
+  EXPECT_TRUE(v.End() > it);
+  EXPECT_TRUE(it >= v.Begin() + 3);
+  auto begin = v.Begin();
+  auto next = begin + 1;
+  EXPECT_EQ(*begin, 1);
+  EXPECT_EQ(*next, 3);
+  s21::Vector<int>::const_iterator cit = it;
+  EXPECT_EQ(cit - v.Cbegin(), 3);
+  EXPECT_EQ(*(v.Cend() - 1), 9);
+}
+
+TEST(VectorTest, InsertMany_Reallocation) {
+  s21::Vector<std::string> vec({"a", "e"});
+  vec.Shrink_To_Fit();
+  auto it = vec.Insert_Many(vec.Cbegin() + 1, "b", std::string("c"), "d");
+  EXPECT_EQ(vec.Size(), 5);
+  EXPECT_EQ(*it, "e");
+  std::string joined;
+  for (size_t i = 0; i < vec.Size(); ++i) joined += vec[i];
+  EXPECT_EQ(joined, "abcde");
+}
+
+TEST(VectorTest, InsertMany_InPlace) {
+  s21::Vector<std::string> vec({"a", "b", "f", "g"});
+  vec.Reserve(16);
+  const std::string* data = vec.Data();
+  vec.Insert_Many(vec.Cbegin() + 2, "c", "d", "e");
+  EXPECT_EQ(vec.Data(), data);
+  vec.Insert_Many(vec.Cbegin() + 6, "x");
+  vec.Insert_Many(vec.Cend() - 1, "y", "z", "w");
+  std::string joined;
+  for (size_t i = 0; i < vec.Size(); ++i) joined += vec[i];
+  EXPECT_EQ(joined, "abcdefxyzwg");
+}
+
+TEST(VectorTest, InsertMany_OwnElements) {
+  s21::Vector<std::string> vec({"one", "two", "three"});
+  vec.Reserve(8);
+  vec.Insert_Many(vec.Cbegin(), vec[2], vec[1]);
+  EXPECT_EQ(vec.Size(), 5);
+  EXPECT_EQ(vec[0], "three");
+  EXPECT_EQ(vec[1], "two");
+  EXPECT_EQ(vec[2], "one");
+  EXPECT_EQ(vec[4], "three");
+}
+
+TEST(VectorTest, InsertManyBack_OwnElementsAtFullCapacity) {
+  s21::Vector<std::string> vec({"a string too long for the small buffer"});
+  vec.Shrink_To_Fit();
+  vec.Insert_Many_Back(vec.At(0), vec.At(0));
+  ASSERT_EQ(vec.Size(), 3);
+  EXPECT_EQ(vec[1], vec[0]);
+  EXPECT_EQ(vec[2], vec[0]);
+}
+
+TEST(VectorTest, Allocator_ElementsComeFromResource) {
+  alignas(std::max_align_t) unsigned char buf[4096];
+  std::pmr::monotonic_buffer_resource arena(buf, sizeof(buf),
+                                            std::pmr::null_memory_resource());
+  s21::Vector<int, std::pmr::polymorphic_allocator<int>> vec(&arena);
+  for (int i = 0; i < 100; ++i) vec.Push_Back(i);
+  const auto* data = reinterpret_cast<const unsigned char*>(vec.Data());
+  EXPECT_TRUE(data >= buf && data < buf + sizeof(buf));
+  EXPECT_EQ(vec.Get_Allocator().resource(), &arena);
+  EXPECT_EQ(vec[99], 99);
+}
+
+TEST(VectorTest, Allocator_PropagatesToElements) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::Vector<std::pmr::string,
+              std::pmr::polymorphic_allocator<std::pmr::string>>
+      vec(&arena);
+  vec.Emplace_Back(64, 'x');
+  vec.Push_Back(std::pmr::string(32, 'y'));
+  vec.Reserve(16);
+  EXPECT_EQ(vec[0].get_allocator().resource(), &arena);
+  EXPECT_EQ(vec[1].get_allocator().resource(), &arena);
+  EXPECT_EQ(vec[0], std::pmr::string(64, 'x'));
+}
+
+TEST(VectorTest, Allocator_MoveBetweenResources) {
+  std::pmr::monotonic_buffer_resource first;
+  std::pmr::monotonic_buffer_resource second;
+  s21::Vector<int, std::pmr::polymorphic_allocator<int>> a(&first);
+  s21::Vector<int, std::pmr::polymorphic_allocator<int>> b(&second);
+  a.Insert_Many_Back(1, 2, 3);
+  b = std::move(a);
+  EXPECT_EQ(b.Get_Allocator().resource(), &second);
+  ASSERT_EQ(b.Size(), 3);
+  EXPECT_EQ(b[2], 3);
+  s21::Vector<int, std::pmr::polymorphic_allocator<int>> c(b);
+  EXPECT_EQ(c.Get_Allocator().resource(), std::pmr::get_default_resource());
+  EXPECT_EQ(c[0], 1);
+}